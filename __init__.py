@@ -110,6 +110,7 @@ class Interverse:
         try:
             await self.disconnect()
             await self.chain.close()
+            self.wallet_manager.storage.close()
         except Exception as e:
             self.logger.error(f"Close error: {e}")
     
@@ -180,6 +181,24 @@ class Interverse:
         """
         return await self.chain.mint_asset(owner_address, properties)
     
+    async def mint_assets_batch(self, owner_address: str, items: List[Dict[str, Any]], 
+                                chunk_size: int = 50,
+                                max_concurrency: Optional[int] = None) -> Dict[str, Any]:
+        """
+        Mint several assets in chunked batch requests.
+        
+        Args:
+            owner_address: Address of the asset owner
+            items: List of asset properties, one entry per asset
+            chunk_size: Maximum number of items per request
+            max_concurrency: Maximum number of requests in flight; defaults to
+                the client's ``mint_batch_concurrency``
+            
+        Returns:
+            Dict containing per-item results in the order of ``items``
+        """
+        return await self.chain.mint_assets_batch(owner_address, items, chunk_size, max_concurrency)
+    
     async def transfer_asset(self, asset_id: str, from_address: str, to_address: str) -> Dict[str, Any]:
         """
         Transfer an asset between wallets.
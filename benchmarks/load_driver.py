@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""
+Load driver for the Interverse Python SDK.
+
+Simulates wallets that mint, transfer and read balances concurrently while
+receiving the resulting WebSocket events, then reports throughput, latency
+percentiles per operation, event delivery lag, event loop stalls and memory.
+Without --node-url it starts benchmarks/mock_node.py in-process.
+
+    python benchmarks/load_driver.py --wallets 50 --clients 5 --duration 30
+    python benchmarks/load_driver.py --json results.json
+    python benchmarks/load_driver.py --baseline results.json --tolerance 0.2
+    python benchmarks/load_driver.py --throughput --uvloop --baseline results.json
+
+With --baseline the run fails (exit code 1) if throughput dropped or a p99
+latency grew by more than the tolerance against the saved results.
+"""
+
+import argparse
+import asyncio
+import json
+import logging
+import os
+import random
+import sys
+import time
+from typing import Dict, Any, List
+
+# Add the directory containing the SDK checkout to the path to import it as "interverse"
+sys.path.insert(0, os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..')))
+
+from interverse.core.chain import InterverseChain
+from interverse.core.telemetry import LatencyHistogram
+from mock_node import start_mock_node
+
+logger = logging.getLogger("interverse.load_driver")
+
+# Interval of the event loop probe, like a 60 Hz game frame
+FRAME_SECONDS = 1.0 / 60.0
+
+def _merge(histograms: List[LatencyHistogram]) -> LatencyHistogram:
+    merged = LatencyHistogram()
+    for histogram in histograms:
+        merged.buckets = [a + b for a, b in zip(merged.buckets, histogram.buckets)]
+        merged.count += histogram.count
+        merged.max_ms = max(merged.max_ms, histogram.max_ms)
+    return merged
+
+def _summary(histogram: LatencyHistogram) -> Dict[str, float]:
+    return {
+        "count": histogram.count,
+        "p50_ms": round(histogram.percentile(0.50), 3),
+        "p95_ms": round(histogram.percentile(0.95), 3),
+        "p99_ms": round(histogram.percentile(0.99), 3),
+        "max_ms": round(histogram.max_ms, 3)
+    }
+
+def _peak_memory_mb() -> float:
+    try:
+        import resource
+    except ImportError:  # Windows
+        return 0.0
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Kilobytes on Linux, bytes on macOS
+    return peak / (1024.0 * 1024.0) if sys.platform == "darwin" else peak / 1024.0
+
+class LoadRun:
+    """One load test: clients, their wallets and the measurements"""
+
+    def __init__(self, node_url: str, args: argparse.Namespace):
+        self.node_url = node_url
+        self.args = args
+        self.clients: List[InterverseChain] = []
+        self.wallets: Dict[str, InterverseChain] = {}
+        self.owned: Dict[str, List[str]] = {}
+        self.event_lag = LatencyHistogram()
+        self.frame_stall = LatencyHistogram()
+        self.events_received = 0
+        self.operations = 0
+
+    async def setup(self) -> None:
+        for _ in range(self.args.clients):
+            chain = InterverseChain(node_url=self.node_url, game_id=self.args.game_id, api_key="benchmark")
+            chain.compress_frames = self.args.compress
+            if self.args.throughput:
+                chain.enable_throughput_mode()
+            chain.on("websocket_message", self._on_message)
+            await chain.initialize()
+            self.clients.append(chain)
+
+        per_client = max(1, self.args.wallets // self.args.clients)
+        for chain in self.clients:
+            addresses = []
+            for _ in range(per_client):
+                result = await chain.create_wallet()
+                if not result.get("success"):
+                    raise RuntimeError(f"Wallet creation failed: {result.get('error')}")
+                address = result["wallet"]["address"]
+                addresses.append(address)
+                self.wallets[address] = chain
+                self.owned[address] = []
+            chain.subscribed_addresses = addresses
+            if not await chain.connect():
+                raise RuntimeError("WebSocket connection to the node failed")
+
+    def _on_message(self, message: Dict[str, Any]) -> None:
+        self.events_received += 1
+        sent_at = message.get("data", {}).get("sent_at")
+        if sent_at:
+            self.event_lag.record((time.time() - sent_at) * 1000.0)
+
+    async def _probe_event_loop(self, deadline: float) -> None:
+        """Record how late a frame-rate timer fires; the Python analogue of game-thread time per frame"""
+        while time.perf_counter() < deadline:
+            start = time.perf_counter()
+            await asyncio.sleep(FRAME_SECONDS)
+            self.frame_stall.record(max(0.0, time.perf_counter() - start - FRAME_SECONDS) * 1000.0)
+
+    async def _simulate_wallet(self, address: str, deadline: float) -> None:
+        chain = self.wallets[address]
+        peers = [peer for peer, owner in self.wallets.items() if owner is chain and peer != address]
+        while time.perf_counter() < deadline:
+            roll = random.random()
+            if roll < self.args.mint_ratio or not self.owned[address] or not peers:
+                result = await chain.mint_asset(address, {"asset_type": "WEAPON", "level": random.randint(1, 50)})
+                if result.get("success"):
+                    self.owned[address].append(result["asset"]["asset_id"])
+            elif roll < self.args.mint_ratio + self.args.transfer_ratio:
+                asset_id = self.owned[address].pop(0)
+                recipient = random.choice(peers)
+                result = await chain.transfer_asset(asset_id, address, recipient)
+                self.owned[recipient if result.get("success") else address].append(asset_id)
+            elif random.random() < 0.5:
+                await chain.get_balance(address)
+            else:
+                # Delta syncs after a transfer carry the assets that left the wallet
+                await chain.get_player_assets(address)
+            self.operations += 1
+            if self.args.think_ms:
+                await asyncio.sleep(random.uniform(0, self.args.think_ms) / 1000.0)
+
+    async def run(self) -> Dict[str, Any]:
+        deadline = time.perf_counter() + self.args.duration
+        start = time.perf_counter()
+        await asyncio.gather(self._probe_event_loop(deadline),
+                             *[self._simulate_wallet(address, deadline) for address in self.wallets])
+        elapsed = time.perf_counter() - start
+
+        histograms: Dict[str, List[LatencyHistogram]] = {}
+        failures: Dict[str, int] = {}
+        for chain in self.clients:
+            for name, state in chain.telemetry.operations.items():
+                histograms.setdefault(name, []).append(state["latency"])
+                failures[name] = failures.get(name, 0) + state["failures"]
+
+        operations = {}
+        for name, parts in sorted(histograms.items()):
+            operations[name] = {**_summary(_merge(parts)), "failures": failures[name]}
+
+        return {
+            "config": {
+                "wallets": len(self.wallets),
+                "clients": len(self.clients),
+                "duration_s": self.args.duration,
+                "compress": self.args.compress,
+                "throughput_mode": self.args.throughput,
+                "uvloop": self.args.uvloop
+            },
+            "throughput_ops_s": round(self.operations / elapsed, 1),
+            "events_received": self.events_received,
+            "events_per_s": round(self.events_received / elapsed, 1),
+            "operations": operations,
+            "event_lag_ms": _summary(self.event_lag),
+            "frame_stall_ms": _summary(self.frame_stall),
+            "http_bytes_sent": sum(chain.telemetry.http_bytes_sent for chain in self.clients),
+            "http_bytes_received": sum(chain.telemetry.http_bytes_received for chain in self.clients),
+            "socket_bytes_received": sum(chain.socket_stats["bytes_received"] for chain in self.clients),
+            "peak_memory_mb": round(_peak_memory_mb(), 1)
+        }
+
+    async def close(self) -> None:
+        for chain in self.clients:
+            await chain.close()
+
+def compare_to_baseline(results: Dict[str, Any], baseline: Dict[str, Any], tolerance: float) -> List[str]:
+    """Regressions of results against baseline beyond tolerance, as readable lines"""
+    regressions = []
+    if results["throughput_ops_s"] < baseline["throughput_ops_s"] * (1.0 - tolerance):
+        regressions.append(f"throughput {results['throughput_ops_s']} ops/s, baseline {baseline['throughput_ops_s']}")
+
+    checks = [(f"{name} p99", stats, baseline["operations"].get(name)) for name, stats in results["operations"].items()]
+    checks.append(("event lag p99", results["event_lag_ms"], baseline.get("event_lag_ms")))
+    checks.append(("frame stall p99", results["frame_stall_ms"], baseline.get("frame_stall_ms")))
+    for label, current, previous in checks:
+        if previous and previous["p99_ms"] > 0 and current["p99_ms"] > previous["p99_ms"] * (1.0 + tolerance):
+            regressions.append(f"{label} {current['p99_ms']} ms, baseline {previous['p99_ms']} ms")
+    return regressions
+
+async def main() -> int:
+    parser = argparse.ArgumentParser(description="Load test the Interverse Python SDK")
+    parser.add_argument("--node-url", help="Node to test against; starts the mock node when omitted")
+    parser.add_argument("--game-id", default="benchmark")
+    parser.add_argument("--wallets", type=int, default=20)
+    parser.add_argument("--clients", type=int, default=2, help="SDK instances the wallets are spread over")
+    parser.add_argument("--duration", type=float, default=10.0, help="Seconds of load")
+    parser.add_argument("--mint-ratio", type=float, default=0.4)
+    parser.add_argument("--transfer-ratio", type=float, default=0.4, help="The rest are balance and asset list reads")
+    parser.add_argument("--think-ms", type=float, default=0.0, help="Random pause between a wallet's calls")
+    parser.add_argument("--latency-ms", type=float, default=5.0, help="Mock node response delay")
+    parser.add_argument("--compress", action="store_true", help="Ask for compressed event frames")
+    parser.add_argument("--throughput", action="store_true", help="Run the clients with enable_throughput_mode()")
+    parser.add_argument("--uvloop", action="store_true", help="Run on uvloop if it is installed")
+    parser.add_argument("--json", help="Write the results to this file")
+    parser.add_argument("--baseline", help="Results file of an earlier run to compare against")
+    parser.add_argument("--tolerance", type=float, default=0.2)
+    args = parser.parse_args()
+    args.clients = max(1, min(args.clients, args.wallets))
+    if args.uvloop and not type(asyncio.get_running_loop()).__module__.startswith("uvloop"):
+        print("uvloop is not installed, running on the default event loop", file=sys.stderr)
+        args.uvloop = False
+
+    logging.basicConfig(level=logging.WARNING)
+
+    runner = None
+    node_url = args.node_url
+    if not node_url:
+        _, runner, node_url = await start_mock_node(latency_ms=args.latency_ms)
+
+    run = LoadRun(node_url, args)
+    try:
+        await run.setup()
+        results = await run.run()
+    finally:
+        await run.close()
+        if runner is not None:
+            await runner.cleanup()
+
+    print(json.dumps(results, indent=2))
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as f:
+            json.dump(results, f, indent=2)
+
+    if args.baseline:
+        with open(args.baseline, "r", encoding="utf-8") as f:
+            regressions = compare_to_baseline(results, json.load(f), args.tolerance)
+        for regression in regressions:
+            print(f"REGRESSION: {regression}")
+        return 1 if regressions else 0
+    return 0
+
+if __name__ == "__main__":
+    # The loop policy has to be set before asyncio.run creates the loop
+    if "--uvloop" in sys.argv:
+        InterverseChain.install_uvloop()
+    sys.exit(asyncio.run(main()))
@@ -0,0 +1,302 @@
+#!/usr/bin/env python3
+"""
+Mock Interverse node for benchmarks and load tests.
+
+Serves the HTTP endpoints and the WebSocket event stream the SDKs use,
+from memory and with a configurable response delay, so SDK changes can be
+measured without the shared node in the way. Routes answer with and
+without the "/verse" prefix of the Unreal SDK.
+
+    python benchmarks/mock_node.py --port 8765 --latency-ms 20
+
+Events carry an extra "sent_at" field (unix seconds) that the load driver
+uses to measure event delivery lag; the SDKs ignore it.
+"""
+
+import argparse
+import asyncio
+import json
+import logging
+import os
+import random
+import sys
+import time
+import uuid
+from datetime import datetime, timezone
+from typing import Dict, Any, List, Set
+
+from aiohttp import web, WSMsgType
+
+# Add the directory containing the SDK checkout to the path to import it as "interverse"
+sys.path.insert(0, os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..')))
+
+from interverse.core import codec
+
+logger = logging.getLogger("interverse.mock_node")
+
+def _now_iso() -> str:
+    return datetime.now(timezone.utc).isoformat()
+
+def _ok(data: Dict[str, Any]) -> web.Response:
+    return web.json_response({"success": True, "data": data})
+
+def _error(message: str, status: int = 200) -> web.Response:
+    return web.json_response({"success": False, "message": message}, status=status)
+
+class _Client:
+    """One WebSocket connection and what it asked for in its handshake"""
+
+    def __init__(self, socket: web.WebSocketResponse):
+        self.socket = socket
+        self.games: Set[str] = set()
+        self.addresses: Set[str] = set()  # Empty receives every event
+        self.compress = False
+
+    def wants(self, game_id: str, addresses: List[str]) -> bool:
+        if self.games and game_id not in self.games:
+            return False
+        return not self.addresses or any(address in self.addresses for address in addresses)
+
+class MockNode:
+    """In-memory wallets, assets and transactions behind the node's API"""
+
+    def __init__(self, latency_ms: float = 0.0, jitter_ms: float = 0.0, failure_rate: float = 0.0):
+        self.latency_ms = latency_ms
+        self.jitter_ms = jitter_ms
+        self.failure_rate = failure_rate
+        self.balances: Dict[str, float] = {}
+        self.assets: Dict[str, Dict[str, Any]] = {}
+        self.transactions: Dict[str, List[Dict[str, Any]]] = {}
+        self.removals: Dict[str, List[Dict[str, str]]] = {}  # Assets that left each address, for delta syncs
+        self.idempotency_keys: Dict[str, Dict[str, Any]] = {}
+        self.clients: List[_Client] = []
+        self.sequence = 0
+        self.requests_served = 0
+
+    def make_app(self) -> web.Application:
+        app = web.Application(middlewares=[self._simulate_network])
+        routes = [
+            web.post("/wallet/create", self.create_wallet),
+            web.get("/wallet/{address}/balance", self.get_balance),
+            web.post("/wallet/balances", self.get_balances),
+            web.get("/wallet/{address}/assets", self.get_assets),
+            web.post("/assets/mint", self.mint),
+            web.post("/assets/mint/batch", self.mint_batch),
+            web.post("/assets/transfer", self.transfer),
+            web.get("/assets/{asset_id}", self.get_asset),
+            web.get("/transactions/{address}", self.get_transactions),
+            web.get("/games/verify", self.verify_game),
+        ]
+        for route in routes:
+            app.router.add_route(route.method, route.path, route.handler)
+            app.router.add_route(route.method, "/verse" + route.path, route.handler)
+        app.router.add_get("/ws", self.websocket)
+        return app
+
+    @web.middleware
+    async def _simulate_network(self, request: web.Request, handler):
+        if request.path != "/ws":
+            self.requests_served += 1
+            delay = self.latency_ms + random.uniform(0, self.jitter_ms)
+            if delay > 0:
+                await asyncio.sleep(delay / 1000.0)
+            if self.failure_rate and random.random() < self.failure_rate:
+                return _error("Simulated failure", status=503)
+        return await handler(request)
+
+    # HTTP
+
+    async def create_wallet(self, request: web.Request) -> web.Response:
+        address = "0x" + uuid.uuid4().hex[:40]
+        self.balances[address] = 100.0
+        return _ok({"address": address, "public_key": uuid.uuid4().hex, "balance": 100.0})
+
+    async def get_balance(self, request: web.Request) -> web.Response:
+        address = request.match_info["address"]
+        return _ok({"address": address, "balance": self.balances.get(address, 0.0)})
+
+    async def get_balances(self, request: web.Request) -> web.Response:
+        body = await request.json()
+        return _ok({"balances": {address: self.balances.get(address, 0.0) for address in body.get("addresses", [])}})
+
+    async def get_assets(self, request: web.Request) -> web.Response:
+        address = request.match_info["address"]
+        since = request.query.get("modified_since")
+        assets = [asset for asset in self.assets.values() if asset["owner"] == address
+                  and (not since or asset["modified_at"] > since)]
+        assets.sort(key=lambda asset: asset["asset_id"])
+        page = self._page(assets, "assets", request)
+        if since and not request.query.get("cursor"):
+            # Reported once per sync, on its first page
+            page["removed_asset_ids"] = [removal["asset_id"] for removal in self.removals.get(address, [])
+                                         if removal["removed_at"] > since and self.assets.get(
+                                             removal["asset_id"], {}).get("owner") != address]
+        return _ok(page)
+
+    async def get_asset(self, request: web.Request) -> web.Response:
+        asset = self.assets.get(request.match_info["asset_id"])
+        return _ok(asset) if asset else _error("Asset not found", status=404)
+
+    async def get_transactions(self, request: web.Request) -> web.Response:
+        since = request.query.get("since")
+        history = [transaction for transaction in self.transactions.get(request.match_info["address"], [])
+                   if not since or transaction["timestamp"] > since]
+        return _ok(self._page(history, "transactions", request))
+
+    async def verify_game(self, request: web.Request) -> web.Response:
+        return _ok({"verified": True})
+
+    async def mint(self, request: web.Request) -> web.Response:
+        replay = self.idempotency_keys.get(request.headers.get("Idempotency-Key", ""))
+        if replay is not None:
+            return _ok(replay)
+        payload = await request.json()
+        asset = self._create_asset(payload)
+        self._remember(request, asset)
+        return _ok(asset)
+
+    async def mint_batch(self, request: web.Request) -> web.Response:
+        payload = await request.json()
+        results = [{"success": True, "asset": self._create_asset(item)} for item in payload.get("items", [])]
+        return _ok({"results": results})
+
+    async def transfer(self, request: web.Request) -> web.Response:
+        replay = self.idempotency_keys.get(request.headers.get("Idempotency-Key", ""))
+        if replay is not None:
+            return _ok(replay)
+        payload = await request.json()
+        asset = self.assets.get(payload.get("asset_id", ""))
+        sender = payload.get("from_address", "")
+        recipient = payload.get("to_address", "")
+        if asset is None or asset["owner"] != sender:
+            return _error("Asset not owned by sender")
+
+        asset["owner"] = recipient
+        asset["modified_at"] = _now_iso()
+        self.removals.setdefault(sender, []).append({"asset_id": asset["asset_id"], "removed_at": asset["modified_at"]})
+        transaction = {
+            "transaction_id": uuid.uuid4().hex,
+            "sender": sender,
+            "recipient": recipient,
+            "asset_id": asset["asset_id"],
+            "transaction_type": "TRANSFER",
+            "status": "completed",
+            "timestamp": asset["modified_at"]
+        }
+        for address in (sender, recipient):
+            self.transactions.setdefault(address, []).append(transaction)
+        self._remember(request, transaction)
+
+        await self.broadcast(asset["game_id"], [sender, recipient],
+                             {"type": "transfer_complete", "data": {**transaction, "success": True}})
+        return _ok(transaction)
+
+    def _create_asset(self, payload: Dict[str, Any]) -> Dict[str, Any]:
+        now = _now_iso()
+        asset = {
+            "asset_id": uuid.uuid4().hex,
+            "owner": payload.get("owner", ""),
+            "game_id": payload.get("game_id", ""),
+            "asset_type": payload.get("asset_type", "COSMETIC"),
+            "metadata": payload.get("metadata", {}),
+            "created_at": now,
+            "modified_at": now
+        }
+        self.assets[asset["asset_id"]] = asset
+        asyncio.ensure_future(self.broadcast(asset["game_id"], [asset["owner"]],
+                                             {"type": "new_asset", "asset": asset}))
+        return asset
+
+    def _remember(self, request: web.Request, data: Dict[str, Any]) -> None:
+        key = request.headers.get("Idempotency-Key")
+        if key:
+            self.idempotency_keys[key] = data
+
+    @staticmethod
+    def _page(items: List[Dict[str, Any]], items_key: str, request: web.Request) -> Dict[str, Any]:
+        server_time = _now_iso()
+        if "limit" not in request.query:
+            return {items_key: items, "server_time": server_time}
+        limit = max(1, int(request.query["limit"]))
+        start = int(request.query.get("cursor") or 0)
+        end = start + limit
+        return {
+            items_key: items[start:end],
+            "next_cursor": str(end) if end < len(items) else None,
+            "server_time": server_time
+        }
+
+    # WebSocket
+
+    async def websocket(self, request: web.Request) -> web.WebSocketResponse:
+        socket = web.WebSocketResponse()
+        await socket.prepare(request)
+        client = _Client(socket)
+        self.clients.append(client)
+        try:
+            async for message in socket:
+                if message.type != WSMsgType.TEXT:
+                    continue
+                try:
+                    data = json.loads(message.data)
+                except json.JSONDecodeError:
+                    continue
+                await self._handle_client_message(client, data)
+        finally:
+            self.clients.remove(client)
+        return socket
+
+    async def _handle_client_message(self, client: _Client, data: Dict[str, Any]) -> None:
+        message_type = data.get("type")
+        addresses = set(data.get("addresses", []))
+        if message_type == "handshake":
+            client.games.add(data.get("game_id", ""))
+            client.addresses = addresses
+            client.compress = data.get("compression") == "zlib"
+            await self._send(client, {"type": "welcome", "game_id": data.get("game_id", ""),
+                                      "resume_token": uuid.uuid4().hex})
+        elif message_type == "subscribe":
+            client.addresses |= addresses
+        elif message_type == "unsubscribe":
+            client.addresses -= addresses
+
+    async def broadcast(self, game_id: str, addresses: List[str], event: Dict[str, Any]) -> None:
+        self.sequence += 1
+        event = {**event, "seq": self.sequence, "sent_at": time.time()}
+        await asyncio.gather(*[self._send(client, event) for client in list(self.clients)
+                               if client.wants(game_id, addresses)], return_exceptions=True)
+
+    @staticmethod
+    async def _send(client: _Client, event: Dict[str, Any]) -> None:
+        text = json.dumps(event)
+        if client.compress:
+            await client.socket.send_bytes(codec.compress_frame(text.encode("utf-8")))
+        else:
+            await client.socket.send_str(text)
+
+async def start_mock_node(host: str = "127.0.0.1", port: int = 0, **options) -> tuple:
+    """Start a MockNode in the running loop; returns (node, runner, url)"""
+    node = MockNode(**options)
+    runner = web.AppRunner(node.make_app())
+    await runner.setup()
+    site = web.TCPSite(runner, host, port)
+    await site.start()
+    bound_port = runner.addresses[0][1]
+    return node, runner, f"http://{host}:{bound_port}"
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Mock Interverse node")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8765)
+    parser.add_argument("--latency-ms", type=float, default=0.0, help="Delay added to every HTTP response")
+    parser.add_argument("--jitter-ms", type=float, default=0.0, help="Random extra delay up to this much")
+    parser.add_argument("--failure-rate", type=float, default=0.0, help="Fraction of requests answered with 503")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO)
+    node = MockNode(args.latency_ms, args.jitter_ms, args.failure_rate)
+    logger.info(f"Mock node listening on http://{args.host}:{args.port}")
+    web.run_app(node.make_app(), host=args.host, port=args.port, print=None)
+
+if __name__ == "__main__":
+    main()
@@ -9,6 +9,11 @@ import logging
 from .chain import InterverseChain
 from .asset import InterverseAsset, ItemCategory, Rarity, Color
 from .wallet import InterverseWallet, WalletManager
+from .cache import AssetCache
+from .outbox import Outbox
+from .transaction_log import TransactionLog
+from .telemetry import Telemetry
+from . import codec
 from .types import (
     Transaction, 
     TransactionType, 
@@ -41,6 +46,11 @@ __all__ = [
     'InterverseAsset',
     'InterverseWallet',
     'WalletManager',
+    'AssetCache',
+    'Outbox',
+    'TransactionLog',
+    'Telemetry',
+    'codec',
     'ItemCategory',
     'Rarity',
     'Color',
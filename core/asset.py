@@ -215,6 +215,24 @@ class InterverseAsset:
             logger.error(f"Invalid JSON for asset: {e}")
             raise ValueError(f"Invalid JSON format: {e}")
     
+    def to_binary(self) -> bytes:
+        """Convert to the compact binary encoding shared with the Unreal SDK
+        
+        source_game and conversion_history are not part of the encoding.
+        """
+        from .codec import encode_properties
+        return encode_properties(self.to_dict())
+    
+    @classmethod
+    def from_binary(cls, data: bytes) -> 'InterverseAsset':
+        """Create asset from the compact binary encoding"""
+        from .codec import decode_properties, CodecError
+        try:
+            return cls.from_dict(decode_properties(data))
+        except CodecError as e:
+            logger.error(f"Invalid binary data for asset: {e}")
+            raise
+    
     @classmethod
     def from_blockchain_format(cls, blockchain_data: Dict[str, Any]) -> 'InterverseAsset':
         """Create asset from blockchain API response format"""
@@ -228,8 +246,9 @@ class InterverseAsset:
             # If data is in the format returned by the Heroku API
             metadata = blockchain_data.get("metadata", {})
             if isinstance(metadata, dict):
-                # Merge the metadata with the base data
-                combined_data = {**blockchain_data, **metadata}
+                # Ids, aliases and enum spellings as the codec reads them, game properties from the metadata
+                from .codec import ASSET_RECORD
+                combined_data = {**blockchain_data, **ASSET_RECORD.normalize(blockchain_data), **metadata}
                 return cls.from_dict(combined_data)
                 
             # If we can't determine the format, use raw data
@@ -0,0 +1,176 @@
+import json
+import os
+import logging
+from typing import Dict, Any, Optional, List
+
+logger = logging.getLogger("interverse.cache")
+
+class AssetCache:
+    """Per-address asset cache kept current by events and delta fetches"""
+
+    def __init__(self, cache_dir: Optional[str] = None):
+        # In-memory records: address -> {asset_id: asset}
+        self.assets: Dict[str, Dict[str, Dict[str, Any]]] = {}
+        # Node time of the last sync per address, sent as modified_since; None until a sync carried one
+        self.synced_up_to: Dict[str, Optional[str]] = {}
+        self.owner_by_asset: Dict[str, str] = {}
+        self.cache_dir = cache_dir
+
+        if self.cache_dir:
+            os.makedirs(self.cache_dir, exist_ok=True)
+
+    def is_warm(self, address: str) -> bool:
+        """Check if a complete asset list is cached for the address"""
+        return address in self.synced_up_to
+
+    def get_assets(self, address: str) -> Optional[List[Dict[str, Any]]]:
+        """Get cached assets, or None if the address has not been synced"""
+        if not self.is_warm(address):
+            return None
+        return list(self.assets.get(address, {}).values())
+
+    def get_sync_marker(self, address: str) -> Optional[str]:
+        """Get the modified_since value for the next delta fetch"""
+        return self.synced_up_to.get(address)
+
+    def find_asset(self, asset_id: str) -> Optional[Dict[str, Any]]:
+        """Get the cached record of an asset under its current owner"""
+        owner = self.owner_by_asset.get(asset_id)
+        return self.assets.get(owner, {}).get(asset_id) if owner else None
+
+    def replace_all(self, address: str, assets: List[Dict[str, Any]], synced_up_to: Optional[str]) -> None:
+        """Store a full asset list from a cold fetch
+
+        Without a node time in the response or the assets the previous mark is
+        kept, or the mark stays None and the next fetch is a full one again.
+        """
+        previous = self.synced_up_to.get(address)
+        for asset_id in self.assets.get(address, {}):
+            self.owner_by_asset.pop(asset_id, None)
+
+        self.assets[address] = {}
+        for asset in assets:
+            self._store(address, asset)
+
+        self.synced_up_to[address] = synced_up_to or self._latest_modified(assets) or previous
+
+    def merge_delta(self, address: str, changed: List[Dict[str, Any]],
+                    removed_ids: List[str], synced_up_to: Optional[str]) -> bool:
+        """Merge a delta fetch result, returns True if anything changed"""
+        for asset in changed:
+            self._store(address, asset)
+
+        removed = 0
+        records = self.assets.setdefault(address, {})
+        for asset_id in removed_ids:
+            if records.pop(asset_id, None) is not None:
+                self.owner_by_asset.pop(asset_id, None)
+                removed += 1
+
+        marker = synced_up_to or self._latest_modified(changed)
+        if marker and marker > (self.synced_up_to.get(address) or ""):
+            self.synced_up_to[address] = marker
+
+        return bool(changed) or removed > 0
+
+    def store_page(self, address: str, assets: List[Dict[str, Any]]) -> None:
+        """Store one page of a paged cold fetch; the list is not warm until mark_complete"""
+        for asset in assets:
+            self._store(address, asset)
+
+    def mark_complete(self, address: str, synced_up_to: Optional[str]) -> None:
+        """End a paged cold fetch"""
+        self.synced_up_to[address] = synced_up_to or self._latest_modified(
+            list(self.assets.get(address, {}).values())) or None
+
+    def apply_asset(self, asset: Dict[str, Any]) -> None:
+        """Apply an incremental asset event from the WebSocket"""
+        asset_id = self._asset_id(asset)
+        owner = asset.get("owner", "")
+        if not asset_id or not owner:
+            return
+
+        previous_owner = self.owner_by_asset.get(asset_id)
+        if previous_owner and previous_owner != owner:
+            self.assets.get(previous_owner, {}).pop(asset_id, None)
+            self.owner_by_asset.pop(asset_id, None)
+
+        # Only track owners we already hold a list for
+        if self.is_warm(owner):
+            self._store(owner, asset)
+
+    def move_asset(self, asset_id: str, from_address: str, to_address: str) -> None:
+        """Move a cached asset after a completed transfer"""
+        asset = self.assets.get(from_address, {}).pop(asset_id, None)
+        if asset is None:
+            return
+
+        self.owner_by_asset.pop(asset_id, None)
+        if self.is_warm(to_address):
+            self._store(to_address, {**asset, "owner": to_address})
+
+    def invalidate(self, address: str) -> None:
+        """Drop cached assets so the next fetch downloads everything"""
+        for asset_id in self.assets.pop(address, {}):
+            self.owner_by_asset.pop(asset_id, None)
+        self.synced_up_to.pop(address, None)
+
+    def load(self, address: str) -> bool:
+        """Warm the cache for an address from disk"""
+        path = self._cache_path(address)
+        if path is None or not os.path.exists(path):
+            return False
+
+        try:
+            with open(path, 'r') as f:
+                data = json.load(f)
+            self.replace_all(address, data.get("assets", []), data.get("synced_up_to"))
+            logger.debug(f"Loaded {len(data.get('assets', []))} cached assets for {address}")
+            return True
+        except Exception as e:
+            logger.warning(f"Discarding corrupt asset cache for {address}: {e}")
+            return False
+
+    def save(self, address: str) -> None:
+        """Write the cached assets for an address to disk"""
+        path = self._cache_path(address)
+        if path is None or not self.is_warm(address):
+            return
+
+        try:
+            with open(path, 'w') as f:
+                json.dump({
+                    "synced_up_to": self.synced_up_to[address],
+                    "assets": list(self.assets.get(address, {}).values())
+                }, f)
+        except Exception as e:
+            logger.error(f"Error saving asset cache for {address}: {e}")
+
+    def _store(self, address: str, asset: Dict[str, Any]) -> None:
+        asset_id = self._asset_id(asset)
+        if not asset_id:
+            return
+
+        # The asset may be cached under its previous owner
+        previous_owner = self.owner_by_asset.get(asset_id)
+        if previous_owner and previous_owner != address:
+            self.assets.get(previous_owner, {}).pop(asset_id, None)
+
+        self.assets.setdefault(address, {})[asset_id] = asset
+        self.owner_by_asset[asset_id] = address
+
+    def _cache_path(self, address: str) -> Optional[str]:
+        if not self.cache_dir:
+            return None
+        safe_name = "".join(c for c in address if c.isalnum() or c in "-_")
+        return os.path.join(self.cache_dir, f"{safe_name}.json")
+
+    @staticmethod
+    def _asset_id(asset: Dict[str, Any]) -> str:
+        return asset.get("asset_id") or asset.get("id") or ""
+
+    @staticmethod
+    def _latest_modified(assets: List[Dict[str, Any]]) -> Optional[str]:
+        # ISO 8601 timestamps from the node compare correctly as strings
+        markers = [str(asset["modified_at"]) for asset in assets if asset.get("modified_at")]
+        return max(markers) if markers else None
@@ -3,16 +3,24 @@ import aiohttp
 import json
 import asyncio
 import logging
+import random
 import time
 from typing import Dict, Any, Optional, List, Callable, Union
 
+from .cache import AssetCache
+from .outbox import Outbox
+from .transaction_log import TransactionLog
+from .telemetry import Telemetry, tracked
+from .codec import decode_event, CodecError, is_compressed_frame, decompress_frame, peek_record_type
+
 logger = logging.getLogger("interverse.chain")
 
 class InterverseChain:
     """Core blockchain connectivity and operations"""
     
     def __init__(self, node_url: str = "https://verse-coin-7b67e4d49b53.herokuapp.com", 
-                game_id: str = "", api_key: str = ""):
+                game_id: str = "", api_key: str = "", asset_cache_dir: Optional[str] = None,
+                outbox_path: Optional[str] = None, transaction_log_dir: Optional[str] = None):
         self.node_url = node_url.rstrip('/')  # Remove trailing slash if present
         self.game_id = game_id
         self.api_key = api_key
@@ -25,18 +33,84 @@ class InterverseChain:
             "balance_updated": [],
             "websocket_connected": [],
             "websocket_message": [],
+            "batch_mint_complete": [],
+            "ready": [],
             "error": []
         }
         self.reconnect_attempts = 0
         self.max_reconnect_attempts = 5
         self.reconnect_delay = 5  # Initial delay in seconds
+        self.max_reconnect_delay = 60  # Cap of the exponential backoff in seconds
+        self.resume_token: Optional[str] = None  # Handed out by the node in the welcome message
+        self.last_sequence = 0  # Highest "seq" received, sent on reconnect so only missed events are replayed
+        self.asset_cache = AssetCache(asset_cache_dir)
+        self.transaction_log = TransactionLog(transaction_log_dir)  # Append-only history per wallet, see get_transaction_history
+        self.binary_frames = False  # Ask the node for binary event frames (see core/codec.py)
+        self.compress_frames = False  # Ask the node for zlib-compressed event frames instead of permessage-deflate
+        self.socket_stats = {"messages_received": 0, "bytes_received": 0, "bytes_decoded": 0,
+                             "messages_sent": 0, "bytes_sent": 0, "events_dropped": 0}
+        self.asset_deltas = True  # Ask the node to send only the changed fields of updated assets
+        self.subscribed_addresses: List[str] = []  # Wallets the node sends events for, empty for every event of the game
+        self.read_cache_ttl = 2.0  # Seconds a balance/asset read is served from memory, 0 disables
+        self._inflight_reads: Dict[str, asyncio.Future] = {}
+        self._read_cache: Dict[str, tuple] = {}  # key -> (expires_at, result)
+        self._bulk_balances_unsupported = False  # Set when the node answers /wallet/balances with 404
+        self.outbox = Outbox(outbox_path)  # Journaled mints/transfers, see enqueue_mint/enqueue_transfer
+        self.outbox_batch_size = 20
+        self._outbox_task: Optional[asyncio.Task] = None
+        self.telemetry = Telemetry()  # See get_stats
+        self._handshake_sent_at: Optional[float] = None
+        # HTTP connection pool, read when the session is created; see enable_throughput_mode
+        self.http_pool_size = 100  # aiohttp's default
+        self.http_pool_size_per_host = 0  # 0 for no per-host cap
+        self.dns_cache_ttl = 10  # Seconds
+        self.dispatch_events_inline = True  # False queues event handlers for a dispatcher task
+        self.max_pending_events = 10000  # Queued handler calls; further events are dropped when full
+        self.mint_batch_concurrency = 1  # Chunks of one mint_assets_batch call in flight at a time
+        self._event_queue: Optional[asyncio.Queue] = None
+        self._event_task: Optional[asyncio.Task] = None
+    
+    def enable_throughput_mode(self, pool_size: int = 512, pool_size_per_host: int = 128,
+                               dns_cache_ttl: int = 300, max_pending_events: int = 10000,
+                               mint_batch_concurrency: int = 8) -> None:
+        """Tune the client for services that send many requests at once, e.g. a minting backend
+        
+        Widens the HTTP connection pool, caches DNS lookups for longer, sends the
+        chunks of ``mint_assets_batch`` concurrently and runs event handlers on a
+        dispatcher task instead of inside the WebSocket receive loop, so a slow
+        handler no longer holds up reading frames.
+        Call before ``initialize``; see also ``install_uvloop``.
+        """
+        self.http_pool_size = pool_size
+        self.http_pool_size_per_host = pool_size_per_host
+        self.dns_cache_ttl = dns_cache_ttl
+        self.max_pending_events = max_pending_events
+        self.mint_batch_concurrency = mint_batch_concurrency
+        self.dispatch_events_inline = False
+    
+    @staticmethod
+    def install_uvloop() -> bool:
+        """Make new event loops use uvloop if it is installed; call before the loop is started"""
+        try:
+            import uvloop
+        except ImportError:
+            return False
+        asyncio.set_event_loop_policy(uvloop.EventLoopPolicy())
+        return True
     
     async def initialize(self) -> bool:
         """Initialize the SDK and establish HTTP session"""
         try:
             if self.http_session is None or self.http_session.closed:
+                connector = aiohttp.TCPConnector(
+                    limit=self.http_pool_size,
+                    limit_per_host=self.http_pool_size_per_host,
+                    ttl_dns_cache=self.dns_cache_ttl
+                )
                 self.http_session = aiohttp.ClientSession(
-                    headers={"X-API-Key": self.api_key, "Content-Type": "application/json"}
+                    connector=connector,
+                    headers={"X-API-Key": self.api_key, "Content-Type": "application/json"},
+                    trace_configs=[self.telemetry.trace_config()]
                 )
             return True
         except Exception as e:
@@ -57,17 +131,33 @@ class InterverseChain:
             ws_url = f"{self.node_url.replace('http', 'ws')}/ws?api_key={self.api_key}"
             logger.info(f"Connecting to WebSocket: {ws_url}")
             
+            # Frame compression replaces permessage-deflate, compressing twice gains nothing
             self.websocket = await websockets.connect(
                 ws_url,
-                extra_headers={"X-API-Key": self.api_key}
+                extra_headers={"X-API-Key": self.api_key},
+                compression=None if self.compress_frames else "deflate"
             )
             
             # Send handshake message
-            handshake_msg = json.dumps({
+            handshake = {
                 "type": "handshake",
                 "game_id": self.game_id
-            })
-            await self.websocket.send(handshake_msg)
+            }
+            if self.binary_frames:
+                handshake["encoding"] = "binary"
+            if self.compress_frames:
+                handshake["compression"] = "zlib"
+            if self.asset_deltas:
+                handshake["asset_deltas"] = True
+            if self.subscribed_addresses:
+                handshake["addresses"] = list(self.subscribed_addresses)
+            if self.resume_token:
+                handshake["resume_token"] = self.resume_token
+            if self.last_sequence:
+                handshake["last_seq"] = self.last_sequence
+            handshake_msg = json.dumps(handshake)
+            self._handshake_sent_at = time.perf_counter()
+            await self._send_socket_message(handshake_msg)
             logger.debug(f"Sent handshake: {handshake_msg}")
             
             # Start message handling
@@ -76,6 +166,10 @@ class InterverseChain:
             self.is_connected = True
             self.reconnect_attempts = 0
             
+            # Connectivity is back, send what was journaled meanwhile
+            if len(self.outbox):
+                self._schedule_outbox_flush()
+            
             # Trigger connected event
             self._trigger_event("websocket_connected", {"success": True})
             return True
@@ -98,6 +192,56 @@ class InterverseChain:
                 self.websocket = None
                 self.is_connected = False
     
+    async def subscribe_addresses(self, addresses: List[str]) -> None:
+        """Only receive events of these wallets (in addition to those already subscribed)"""
+        added = [address for address in dict.fromkeys(addresses)
+                 if address and address not in self.subscribed_addresses]
+        if not added:
+            return
+        self.subscribed_addresses.extend(added)
+        await self._send_subscription("subscribe", added)
+    
+    async def unsubscribe_addresses(self, addresses: List[str]) -> None:
+        """Stop receiving events of these wallets; without any left every event of the game is received again"""
+        removed = [address for address in dict.fromkeys(addresses) if address in self.subscribed_addresses]
+        if not removed:
+            return
+        self.subscribed_addresses = [address for address in self.subscribed_addresses if address not in removed]
+        await self._send_subscription("unsubscribe", removed)
+    
+    async def _send_subscription(self, message_type: str, addresses: List[str]) -> None:
+        # Offline changes are sent with the next handshake
+        if self.websocket is None or not self.is_connected:
+            return
+        try:
+            await self._send_socket_message(json.dumps({
+                "type": message_type,
+                "game_id": self.game_id,
+                "addresses": addresses
+            }))
+        except Exception as e:
+            logger.warning(f"Failed to send {message_type} for {len(addresses)} addresses: {e}")
+    
+    async def _send_socket_message(self, message: str) -> None:
+        self.socket_stats["messages_sent"] += 1
+        self.socket_stats["bytes_sent"] += len(message.encode("utf-8"))
+        await self.websocket.send(message)
+    
+    def get_stats(self) -> Dict[str, Any]:
+        """Per-operation call counts, failures, in-flight calls and p50/p95/p99 latency in ms,
+        HTTP payload bytes, reconnects and the WebSocket counters of get_socket_stats"""
+        stats = self.telemetry.get_stats()
+        stats["socket"] = self.get_socket_stats()
+        return stats
+    
+    def get_socket_stats(self) -> Dict[str, Any]:
+        """WebSocket traffic counters; bytes_received is counted after permessage-deflate but before frame decompression"""
+        stats = dict(self.socket_stats)
+        stats["compression_ratio"] = (stats["bytes_received"] / stats["bytes_decoded"]
+                                      if stats["bytes_decoded"] else 1.0)
+        return stats
+    
+    @tracked("create_wallet")
     async def create_wallet(self) -> Dict[str, Any]:
         """Create a new blockchain wallet"""
         if not await self.ensure_initialized():
@@ -126,14 +270,23 @@ class InterverseChain:
             self._trigger_event("error", {"message": f"Wallet creation failed: {e}"})
             return {"success": False, "error": str(e)}
     
+    @tracked("get_balance")
     async def get_balance(self, address: str) -> Dict[str, Any]:
-        """Get wallet balance"""
+        """Get wallet balance
+        
+        Concurrent calls for the same address share one request, and results
+        are reused for ``read_cache_ttl`` seconds.
+        """
         if not await self.ensure_initialized():
             return {"success": False, "error": "Not initialized"}
             
         if not address or not isinstance(address, str):
             return {"success": False, "error": "Invalid address"}
             
+        return await self._single_flight(f"balance:{address}", lambda: self._fetch_balance(address))
+    
+    async def _fetch_balance(self, address: str) -> Dict[str, Any]:
+        """Request the balance of ``address`` from the node"""
         try:
             async with self.http_session.get(
                 f"{self.node_url}/wallet/{address}/balance"
@@ -168,17 +321,136 @@ class InterverseChain:
             self._trigger_event("error", {"message": f"Balance check failed: {e}"})
             return {"success": False, "error": str(e)}
     
-    async def get_player_assets(self, address: str) -> Dict[str, Any]:
-        """Get assets owned by a player"""
+    @tracked("get_balances")
+    async def get_balances(self, addresses: List[str], chunk_size: int = 500,
+                           max_concurrency: int = 4) -> Dict[str, Any]:
+        """Get the balances of many wallets in as few requests as possible
+        
+        Balances still fresh in the read cache are reused. The rest are sent in
+        chunks of ``chunk_size`` addresses, at most ``max_concurrency`` requests
+        at a time; nodes without the bulk endpoint are asked address by address
+        under the same bound. ``balances`` maps every address read to its
+        balance, ``errors`` every other address to the reason.
+        """
+        if not await self.ensure_initialized():
+            return {"success": False, "error": "Not initialized"}
+            
+        balances: Dict[str, float] = {}
+        errors: Dict[str, str] = {}
+        missing: List[str] = []
+        now = time.monotonic()
+        for address in dict.fromkeys(addresses):
+            if not address or not isinstance(address, str):
+                errors[str(address)] = "Invalid address"
+                continue
+            cached = self._read_cache.get(f"balance:{address}")
+            if cached is not None and cached[0] > now:
+                balances[address] = cached[1]["balance"]
+            else:
+                missing.append(address)
+                
+        semaphore = asyncio.Semaphore(max(1, max_concurrency))
+        
+        async def read_one(address: str) -> tuple:
+            async with semaphore:
+                return address, await self.get_balance(address)
+                
+        async def read_chunk(chunk: List[str]) -> Dict[str, Dict[str, Any]]:
+            if not self._bulk_balances_unsupported:
+                async with semaphore:
+                    results = await self._fetch_balances(chunk)
+                if results is not None:
+                    return results
+            return dict(await asyncio.gather(*[read_one(address) for address in chunk]))
+            
+        chunk_size = max(1, chunk_size)
+        chunks = [missing[start:start + chunk_size] for start in range(0, len(missing), chunk_size)]
+        for results in await asyncio.gather(*[read_chunk(chunk) for chunk in chunks]):
+            for address, result in results.items():
+                if result.get("success", False):
+                    balances[address] = result["balance"]
+                else:
+                    errors[address] = result.get("error", "Unknown error")
+                    
+        return {"success": not errors, "balances": balances, "errors": errors}
+    
+    async def _fetch_balances(self, addresses: List[str]) -> Optional[Dict[str, Dict[str, Any]]]:
+        """Request the balances of ``addresses`` in one call; None if the node has no bulk endpoint"""
+        try:
+            async with self.http_session.post(
+                f"{self.node_url}/wallet/balances",
+                json={"addresses": addresses}
+            ) as response:
+                if response.status == 404:
+                    logger.warning("Node has no bulk balance endpoint, reading balances one by one")
+                    self._bulk_balances_unsupported = True
+                    return None
+                if response.status != 200:
+                    error_text = await response.text()
+                    logger.error(f"Bulk balance check failed: HTTP {response.status} - {error_text}")
+                    error = f"HTTP {response.status}: {error_text}"
+                    return {address: {"success": False, "error": error} for address in addresses}
+                    
+                data = await response.json()
+                if not data.get("success", False):
+                    error = data.get("message", "Unknown error")
+                    logger.error(f"Bulk balance check failed: {error}")
+                    return {address: {"success": False, "error": error} for address in addresses}
+                    
+                found = data.get("data", {}).get("balances", {})
+                
+        except Exception as e:
+            logger.error(f"Bulk balance check error: {e}")
+            self._trigger_event("error", {"message": f"Bulk balance check failed: {e}"})
+            return {address: {"success": False, "error": str(e)} for address in addresses}
+            
+        results = {}
+        for address in addresses:
+            if address not in found:
+                results[address] = {"success": False, "error": "Response contains no balance"}
+                continue
+                
+            result = {"success": True, "address": address, "balance": found[address]}
+            if self.read_cache_ttl > 0:
+                self._read_cache[f"balance:{address}"] = (time.monotonic() + self.read_cache_ttl, result)
+            self._trigger_event("balance_updated", {"address": address, "balance": found[address]})
+            results[address] = result
+        return results
+    
+    @tracked("get_player_assets")
+    async def get_player_assets(self, address: str, use_cache: bool = True) -> Dict[str, Any]:
+        """Get assets owned by a player
+        
+        The full list is downloaded once per address; later calls only fetch
+        assets modified since the last sync and merge them into the cache.
+        Concurrent calls share one request like ``get_balance``.
+        """
         if not await self.ensure_initialized():
             return {"success": False, "error": "Not initialized"}
             
         if not address or not isinstance(address, str):
             return {"success": False, "error": "Invalid address"}
             
+        key = f"assets:{address}"
+        if not use_cache:
+            self._forget_read(key)
+            self.asset_cache.invalidate(address)
+            return await self._fetch_player_assets(address)
+            
+        return await self._single_flight(key, lambda: self._fetch_player_assets(address))
+    
+    async def _fetch_player_assets(self, address: str) -> Dict[str, Any]:
+        """Fetch the full asset list or a delta and update the cache"""
+        if not self.asset_cache.is_warm(address):
+            self.asset_cache.load(address)
+            
+        since = self.asset_cache.get_sync_marker(address)
+        params = {"modified_since": since} if since else None
+            
         try:
             async with self.http_session.get(
-                f"{self.node_url}/wallet/{address}/assets"
+                f"{self.node_url}/wallet/{address}/assets",
+                params=params
             ) as response:
                 if response.status != 200:
                     error_text = await response.text()
@@ -187,12 +459,23 @@ class InterverseChain:
                     
                 data = await response.json()
                 if data.get("success", False):
-                    assets = data.get("data", {}).get("assets", [])
-                    logger.debug(f"Retrieved {len(assets)} assets for {address}")
+                    asset_data = data.get("data", {})
+                    assets = asset_data.get("assets", [])
+                    server_time = asset_data.get("server_time")
+                    
+                    if since and self.asset_cache.is_warm(address):
+                        self.asset_cache.merge_delta(
+                            address, assets, asset_data.get("removed_asset_ids", []), server_time)
+                        logger.debug(f"Delta sync for {address}: {len(assets)} changed")
+                    else:
+                        self.asset_cache.replace_all(address, assets, server_time)
+                        logger.debug(f"Retrieved {len(assets)} assets for {address}")
+                    self.asset_cache.save(address)
+                    
                     return {
                         "success": True,
                         "address": address,
-                        "assets": assets
+                        "assets": self.asset_cache.get_assets(address) or []
                     }
                 else:
                     logger.error(f"Asset fetch failed: {data.get('message', 'Unknown error')}")
@@ -203,6 +486,101 @@ class InterverseChain:
             self._trigger_event("error", {"message": f"Asset fetch failed: {e}"})
             return {"success": False, "error": str(e)}
     
+    @tracked("get_player_assets_page")
+    async def get_player_assets_page(self, address: str, cursor: Optional[str] = None,
+                                     limit: int = 100) -> Dict[str, Any]:
+        """Get one page of a player's assets, bypassing the cache
+        
+        Pass the returned ``next_cursor`` to get the following page; it is
+        None on the last page.
+        """
+        if not await self.ensure_initialized():
+            return {"success": False, "error": "Not initialized"}
+            
+        if not address or not isinstance(address, str):
+            return {"success": False, "error": "Invalid address"}
+            
+        return await self._fetch_page(f"/wallet/{address}/assets", "assets", address, cursor, limit)
+    
+    async def iter_player_assets(self, address: str, page_size: int = 100):
+        """Yield a player's assets page by page as they arrive
+        
+        Each item has the shape of ``get_player_assets_page``; iteration ends
+        after the page with ``last_page`` set or a failed page. Pages also fill the asset cache. A
+        warm cache is delta-synced first and then paged out locally.
+        """
+        if not self.asset_cache.is_warm(address):
+            self.asset_cache.load(address)
+            
+        if self.asset_cache.is_warm(address):
+            result = await self.get_player_assets(address)
+            if not result.get("success"):
+                yield result
+                return
+            assets = result["assets"]
+            for start in range(0, max(len(assets), 1), page_size):
+                yield {"success": True, "address": address, "assets": assets[start:start + page_size],
+                       "next_cursor": None, "last_page": start + page_size >= len(assets)}
+            return
+            
+        # Cold: the list only counts as complete once the last page is in
+        self._forget_read(f"assets:{address}")
+        self.asset_cache.invalidate(address)
+        cursor = None
+        synced_up_to = None
+        while True:
+            page = await self.get_player_assets_page(address, cursor, page_size)
+            if not page.get("success"):
+                yield page
+                return
+                
+            # Changes made while later pages load are caught by the next delta sync from the first page's time
+            if cursor is None:
+                synced_up_to = page.get("server_time")
+            self.asset_cache.store_page(address, page["assets"])
+            cursor = page.get("next_cursor")
+            if not cursor:
+                self.asset_cache.mark_complete(address, synced_up_to)
+                self.asset_cache.save(address)
+            yield page
+            if not cursor:
+                return
+    
+    async def _fetch_page(self, path: str, items_key: str, address: str,
+                          cursor: Optional[str], limit: int) -> Dict[str, Any]:
+        """GET one cursor page; nodes without pagination answer with everything and no cursor"""
+        params = {"limit": str(limit)}
+        if cursor:
+            params["cursor"] = cursor
+            
+        try:
+            async with self.http_session.get(f"{self.node_url}{path}", params=params) as response:
+                if response.status != 200:
+                    error_text = await response.text()
+                    logger.error(f"Page fetch of {path} failed: HTTP {response.status} - {error_text}")
+                    return {"success": False, "error": f"HTTP {response.status}: {error_text}"}
+                    
+                data = await response.json()
+                if not data.get("success", False):
+                    logger.error(f"Page fetch of {path} failed: {data.get('message', 'Unknown error')}")
+                    return {"success": False, "error": data.get("message", "Unknown error")}
+                    
+                page_data = data.get("data", {})
+                return {
+                    "success": True,
+                    "address": address,
+                    items_key: page_data.get(items_key, []),
+                    "next_cursor": page_data.get("next_cursor") or None,
+                    "last_page": not page_data.get("next_cursor"),
+                    "server_time": page_data.get("server_time")
+                }
+                
+        except Exception as e:
+            logger.error(f"Page fetch error for {path}: {e}")
+            self._trigger_event("error", {"message": f"Page fetch failed: {e}"})
+            return {"success": False, "error": str(e)}
+    
+    @tracked("mint_asset")
     async def mint_asset(self, owner_address: str, properties: Dict[str, Any]) -> Dict[str, Any]:
         """Mint a new game asset on the blockchain"""
         if not await self.ensure_initialized():
@@ -212,22 +590,7 @@ class InterverseChain:
             return {"success": False, "error": "Invalid owner address"}
             
         try:
-            # Build payload based on the expected format of your Heroku API
-            payload = {
-                "owner": owner_address,
-                "game_id": self.game_id
-            }
-            
-            # Handle different property format options
-            if "asset_type" in properties:
-                payload["asset_type"] = properties["asset_type"]
-            elif "category" in properties:
-                payload["asset_type"] = properties["category"]
-            else:
-                payload["asset_type"] = "COSMETIC"  # Default type
-                
-            # Add metadata
-            payload["metadata"] = properties
+            payload = self._build_mint_payload(owner_address, properties)
             
             logger.debug(f"Minting asset payload: {json.dumps(payload)}")
             
@@ -245,6 +608,7 @@ class InterverseChain:
                     asset_data = data.get("data", {})
                     asset_id = asset_data.get("asset_id", "")
                     logger.info(f"Asset minted: {asset_id} for {owner_address}")
+                    self._forget_read(f"assets:{owner_address}")
                     
                     self._trigger_event("asset_minted", {
                         "asset": asset_data,
@@ -264,6 +628,125 @@ class InterverseChain:
             self._trigger_event("error", {"message": f"Asset minting failed: {e}"})
             return {"success": False, "error": str(e)}
     
+    @tracked("mint_assets_batch")
+    async def mint_assets_batch(self, owner_address: str, items: List[Dict[str, Any]],
+                                chunk_size: int = 50,
+                                max_concurrency: Optional[int] = None) -> Dict[str, Any]:
+        """Mint several assets using as few requests as possible
+        
+        Items are sent in chunks of ``chunk_size``, at most ``max_concurrency``
+        requests at a time (``mint_batch_concurrency`` if not given, one unless
+        throughput mode is on). An ``asset_minted`` event is triggered for every
+        minted item and ``batch_mint_complete`` once all chunks have finished.
+        ``results`` is ordered like ``items``.
+        """
+        if not await self.ensure_initialized():
+            return {"success": False, "error": "Not initialized"}
+            
+        if not owner_address or not isinstance(owner_address, str):
+            return {"success": False, "error": "Invalid owner address"}
+            
+        if not items:
+            return {"success": False, "error": "No items to mint"}
+            
+        chunk_size = max(1, chunk_size)
+        if max_concurrency is None:
+            max_concurrency = self.mint_batch_concurrency
+        semaphore = asyncio.Semaphore(max(1, max_concurrency))
+        
+        async def mint_chunk(chunk: List[Dict[str, Any]]) -> List[Dict[str, Any]]:
+            async with semaphore:
+                return await self._mint_chunk(owner_address, chunk)
+                
+        chunks = [items[start:start + chunk_size] for start in range(0, len(items), chunk_size)]
+        results: List[Dict[str, Any]] = []
+        for chunk_results in await asyncio.gather(*[mint_chunk(chunk) for chunk in chunks]):
+            results.extend(chunk_results)
+            
+        succeeded = sum(1 for result in results if result.get("success", False))
+        failed = len(results) - succeeded
+        logger.info(f"Batch mint finished for {owner_address}: {succeeded} succeeded, {failed} failed")
+        
+        self._trigger_event("batch_mint_complete", {
+            "owner": owner_address,
+            "succeeded": succeeded,
+            "failed": failed
+        })
+        
+        return {
+            "success": failed == 0,
+            "succeeded": succeeded,
+            "failed": failed,
+            "results": results
+        }
+    
+    async def _mint_chunk(self, owner_address: str, chunk: List[Dict[str, Any]]) -> List[Dict[str, Any]]:
+        """Send one batch mint request and return per-item results"""
+        payload = {
+            "owner": owner_address,
+            "game_id": self.game_id,
+            "items": [self._build_mint_payload(owner_address, properties) for properties in chunk]
+        }
+        
+        try:
+            async with self.http_session.post(
+                f"{self.node_url}/assets/mint/batch",
+                json=payload
+            ) as response:
+                if response.status != 200:
+                    error_text = await response.text()
+                    logger.error(f"Batch minting failed: HTTP {response.status} - {error_text}")
+                    error = f"HTTP {response.status}: {error_text}"
+                    return [{"success": False, "error": error} for _ in chunk]
+                    
+                data = await response.json()
+                if not data.get("success", False):
+                    error = data.get("message", "Unknown error")
+                    logger.error(f"Batch minting failed: {error}")
+                    return [{"success": False, "error": error} for _ in chunk]
+                    
+                item_results = data.get("data", {}).get("results", [])
+                
+        except Exception as e:
+            logger.error(f"Batch minting error: {e}")
+            self._trigger_event("error", {"message": f"Batch minting failed: {e}"})
+            return [{"success": False, "error": str(e)} for _ in chunk]
+            
+        results = []
+        for index in range(len(chunk)):
+            item = item_results[index] if index < len(item_results) else {}
+            if item.get("success", False):
+                asset_data = item.get("asset", {})
+                self._trigger_event("asset_minted", {
+                    "asset": asset_data,
+                    "owner": owner_address
+                })
+                results.append({"success": True, "asset": asset_data})
+            else:
+                results.append({"success": False, "error": item.get("message", "Missing result")})
+                
+        return results
+    
+    def _build_mint_payload(self, owner_address: str, properties: Dict[str, Any]) -> Dict[str, Any]:
+        """Build a mint payload based on the expected format of the Heroku API"""
+        payload = {
+            "owner": owner_address,
+            "game_id": self.game_id
+        }
+        
+        # Handle different property format options
+        if "asset_type" in properties:
+            payload["asset_type"] = properties["asset_type"]
+        elif "category" in properties:
+            payload["asset_type"] = properties["category"]
+        else:
+            payload["asset_type"] = "COSMETIC"  # Default type
+            
+        # Add metadata
+        payload["metadata"] = properties
+        return payload
+    
+    @tracked("transfer_asset")
     async def transfer_asset(self, asset_id: str, from_address: str, to_address: str) -> Dict[str, Any]:
         """Transfer an asset between addresses"""
         if not await self.ensure_initialized():
@@ -296,6 +779,8 @@ class InterverseChain:
                 if transfer_success:
                     transfer_data = data.get("data", {})
                     logger.info(f"Asset transferred: {asset_id} to {to_address}")
+                    self._forget_read(f"assets:{from_address}")
+                    self._forget_read(f"assets:{to_address}")
                     
                     self._trigger_event("transfer_complete", {
                         "asset_id": asset_id,
@@ -330,6 +815,115 @@ class InterverseChain:
             self._trigger_event("error", {"message": f"Asset transfer failed: {e}"})
             return {"success": False, "error": str(e)}
     
+    async def enqueue_mint(self, owner_address: str, properties: Dict[str, Any]) -> Dict[str, Any]:
+        """Journal a mint and send it in the background
+        
+        Returns at once with the operation's idempotency key. The result
+        arrives as an ``asset_minted`` event (or ``error``) once the node has
+        answered, also if that only happens after a restart.
+        """
+        if not owner_address or not isinstance(owner_address, str):
+            return {"success": False, "error": "Invalid owner address"}
+            
+        key = self.outbox.enqueue("mint", "/assets/mint", self._build_mint_payload(owner_address, properties))
+        self._schedule_outbox_flush()
+        return {"success": True, "queued": True, "idempotency_key": key}
+    
+    async def enqueue_transfer(self, asset_id: str, from_address: str, to_address: str) -> Dict[str, Any]:
+        """Journal a transfer and send it in the background, see ``enqueue_mint``"""
+        if not asset_id or not from_address or not to_address:
+            return {"success": False, "error": "Missing required parameters"}
+            
+        key = self.outbox.enqueue("transfer", "/assets/transfer", {
+            "asset_id": asset_id,
+            "from_address": from_address,
+            "to_address": to_address
+        })
+        self._schedule_outbox_flush()
+        return {"success": True, "queued": True, "idempotency_key": key}
+    
+    @tracked("flush_outbox")
+    async def flush_outbox(self) -> Dict[str, Any]:
+        """Send journaled operations batch by batch until the outbox is empty
+        
+        Stops at the first batch in which the node could not be reached;
+        those operations stay journaled for the next flush.
+        """
+        if not await self.ensure_initialized():
+            return {"success": False, "error": "Not initialized"}
+            
+        sent = 0
+        while len(self.outbox):
+            batch = self.outbox.peek(self.outbox_batch_size)
+            answered = await asyncio.gather(*[self._send_outbox_entry(entry) for entry in batch])
+            sent += sum(1 for ok in answered if ok)
+            if not all(answered):
+                return {"success": False, "sent": sent, "pending": len(self.outbox),
+                        "error": "Node unreachable"}
+                        
+        return {"success": True, "sent": sent, "pending": 0}
+    
+    async def _send_outbox_entry(self, entry: Dict[str, Any]) -> bool:
+        """Send one journaled operation, returns False if it should be retried"""
+        key = entry["add"]
+        payload = entry["payload"]
+        try:
+            async with self.http_session.post(
+                f"{self.node_url}{entry['endpoint']}",
+                json=payload,
+                headers={"Idempotency-Key": key}
+            ) as response:
+                # Timeouts, throttling and server errors are worth another try
+                if response.status in (408, 429) or response.status >= 500:
+                    logger.warning(f"Outbox {entry['op']} {key} deferred: HTTP {response.status}")
+                    return False
+                    
+                data = await response.json() if response.status == 200 else {}
+                if not isinstance(data, dict):
+                    raise ValueError(f"unexpected response body {type(data).__name__}")
+                error = None if data.get("success", False) else data.get("message", f"HTTP {response.status}")
+                
+        # An unreadable answer may come from a proxy; the idempotency key makes resending safe
+        except (aiohttp.ClientError, asyncio.TimeoutError, ValueError) as e:
+            logger.warning(f"Outbox {entry['op']} {key} deferred: {e}")
+            return False
+            
+        # The node has answered; resending cannot change the outcome
+        self.outbox.acknowledge(key)
+        
+        if error:
+            logger.error(f"Outbox {entry['op']} {key} rejected: {error}")
+            self._trigger_event("error", {"message": f"Queued {entry['op']} failed: {error}",
+                                          "idempotency_key": key})
+            if entry["op"] == "transfer":
+                self._trigger_event("transfer_complete", dict(payload, success=False, error=error))
+        elif entry["op"] == "mint":
+            asset_data = data.get("data", {})
+            self._forget_read(f"assets:{payload.get('owner', '')}")
+            self._trigger_event("asset_minted", {"asset": asset_data, "owner": payload.get("owner", "")})
+        else:
+            self._forget_read(f"assets:{payload.get('from_address', '')}")
+            self._forget_read(f"assets:{payload.get('to_address', '')}")
+            self._trigger_event("transfer_complete", dict(payload, success=True))
+        return True
+    
+    def _schedule_outbox_flush(self) -> None:
+        """Start the background flusher unless it is already running"""
+        if self._outbox_task is None or self._outbox_task.done():
+            self._outbox_task = asyncio.create_task(self._run_outbox())
+    
+    async def _run_outbox(self):
+        """Flush the outbox, backing off with jitter while the node is unreachable"""
+        attempt = 0
+        while len(self.outbox):
+            result = await self.flush_outbox()
+            if result.get("success"):
+                return
+            step = min(self.max_reconnect_delay, self.reconnect_delay * (2 ** attempt))
+            attempt += 1
+            await asyncio.sleep(step / 2 + random.uniform(0, step / 2))
+    
+    @tracked("get_asset")
     async def get_asset(self, asset_id: str) -> Dict[str, Any]:
         """Get details of a specific asset"""
         if not await self.ensure_initialized():
@@ -364,17 +958,41 @@ class InterverseChain:
             self._trigger_event("error", {"message": f"Asset fetch failed: {e}"})
             return {"success": False, "error": str(e)}
     
-    async def get_transaction_history(self, address: str) -> Dict[str, Any]:
-        """Get transaction history for an address"""
+    @tracked("get_transaction_history")
+    async def get_transaction_history(self, address: str, limit: Optional[int] = None,
+                                      cursor: Optional[str] = None) -> Dict[str, Any]:
+        """Get transaction history for an address
+        
+        Without ``limit`` the whole history is returned from the local
+        transaction log, after asking the node only for the entries newer
+        than the log's high-water mark; ``new_transactions`` holds the ones
+        this call added. With ``limit``, one page is fetched from the node
+        and returned together with the ``next_cursor`` of the following page
+        (None on the last page); see also ``iter_transaction_history``.
+        """
         if not await self.ensure_initialized():
             return {"success": False, "error": "Not initialized"}
             
         if not address or not isinstance(address, str):
             return {"success": False, "error": "Invalid address"}
             
+        if limit is not None:
+            return await self._fetch_page(f"/transactions/{address}", "transactions", address, cursor, limit)
+            
+        return await self._sync_transactions(address)
+    
+    async def _sync_transactions(self, address: str) -> Dict[str, Any]:
+        """Fetch the transactions after the log's high-water mark and append them"""
+        if not self.transaction_log.is_synced(address):
+            self.transaction_log.load(address)
+            
+        since = self.transaction_log.get_sync_marker(address)
+        params = {"since": since} if since else None
+            
         try:
             async with self.http_session.get(
-                f"{self.node_url}/transactions/{address}"
+                f"{self.node_url}/transactions/{address}",
+                params=params
             ) as response:
                 if response.status != 200:
                     error_text = await response.text()
@@ -385,11 +1003,17 @@ class InterverseChain:
                 if data.get("success", False):
                     tx_data = data.get("data", {})
                     transactions = tx_data.get("transactions", [])
-                    logger.debug(f"Retrieved {len(transactions)} transactions for {address}")
+                    # Nodes without server_time: the newest timestamp seen is the next mark
+                    synced_up_to = tx_data.get("server_time") or max(
+                        (tx.get("timestamp", "") for tx in transactions), default=since or "")
+                    
+                    added = self.transaction_log.append(address, transactions, synced_up_to)
+                    logger.debug(f"Synced {len(added)} new transactions for {address}")
                     return {
                         "success": True,
                         "address": address,
-                        "transactions": transactions
+                        "transactions": self.transaction_log.get_transactions(address) or [],
+                        "new_transactions": added
                     }
                 else:
                     logger.error(f"Transaction history failed: {data.get('message', 'Unknown error')}")
@@ -400,6 +1024,17 @@ class InterverseChain:
             self._trigger_event("error", {"message": f"Transaction history failed: {e}"})
             return {"success": False, "error": str(e)}
     
+    async def iter_transaction_history(self, address: str, page_size: int = 100):
+        """Yield the transaction history page by page, ending after the last or a failed page"""
+        cursor = None
+        while True:
+            page = await self.get_transaction_history(address, limit=page_size, cursor=cursor)
+            yield page
+            cursor = page.get("next_cursor")
+            if not page.get("success") or not cursor:
+                return
+    
+    @tracked("verify_game")
     async def verify_game(self) -> Dict[str, Any]:
         """Verify game registration with the blockchain"""
         if not await self.ensure_initialized():
@@ -431,6 +1066,56 @@ class InterverseChain:
             self._trigger_event("error", {"message": f"Game verification failed: {e}"})
             return {"success": False, "error": str(e)}
     
+    @tracked("warm_up")
+    async def warm_up(self, player_address: str, connect: bool = True) -> Dict[str, Any]:
+        """Login prefetch: connect, verify the game and read the player's balance and assets concurrently
+
+        Each step reports under its own key; success only if all of them
+        succeeded. The balance and asset caches are warm afterwards and the
+        "ready" event fires with the result, also when a step failed. With
+        connect=False the socket is left alone and does not count.
+        """
+        if not player_address or not isinstance(player_address, str):
+            return {"success": False, "error": "Invalid address"}
+        if not await self.ensure_initialized():
+            return {"success": False, "error": "Not initialized"}
+
+        # Wallet routing would otherwise drop the player's events
+        if self.subscribed_addresses and player_address not in self.subscribed_addresses:
+            await self.subscribe_addresses([player_address])
+
+        steps = {
+            "game": self.verify_game(),
+            "balance": self.get_balance(player_address),
+            "assets": self.get_player_assets(player_address),
+        }
+        if connect and not self.is_connected:
+            steps["websocket"] = self.connect()
+        outcomes = await asyncio.gather(*steps.values(), return_exceptions=True)
+
+        result: Dict[str, Any] = {"address": player_address}
+        for name, outcome in zip(steps, outcomes):
+            if isinstance(outcome, BaseException):
+                outcome = {"success": False, "error": str(outcome)}
+            elif isinstance(outcome, bool):
+                outcome = {"success": outcome}
+            result[name] = outcome
+        if not connect:
+            result["websocket"] = {"success": self.is_connected, "skipped": True}
+        result.setdefault("websocket", {"success": True})
+
+        # A skipped connect reports the socket state but cannot fail the warm-up
+        checked = ("websocket", "game", "balance", "assets") if connect else ("game", "balance", "assets")
+        failed = [name for name in checked if not result[name].get("success")]
+        result["success"] = not failed
+        if failed:
+            result["error"] = f"{failed[0]} step failed: {result[failed[0]].get('error', 'not connected')}"
+            logger.warning(f"Warm-up of {player_address} incomplete: {result['error']}")
+
+        self._trigger_event("ready", result)
+        return result
+    
+    @tracked("update_asset")
     async def update_asset(self, asset_id: str, properties: Dict[str, Any]) -> Dict[str, Any]:
         """Update an existing asset's properties"""
         if not await self.ensure_initialized():
@@ -490,6 +1175,44 @@ class InterverseChain:
             self._trigger_event("error", {"message": f"Asset update failed: {e}"})
             return {"success": False, "error": str(e)}
     
+    async def _single_flight(self, key: str, fetch: Callable) -> Dict[str, Any]:
+        """Run ``fetch`` once for all concurrent callers of ``key``
+        
+        Successful results are kept for ``read_cache_ttl`` seconds. Every
+        caller gets its own shallow copy of the result.
+        """
+        cached = self._read_cache.get(key)
+        if cached is not None:
+            if cached[0] > time.monotonic():
+                return dict(cached[1])
+            del self._read_cache[key]
+            
+        future = self._inflight_reads.get(key)
+        if future is None:
+            future = asyncio.get_running_loop().create_future()
+            self._inflight_reads[key] = future
+            try:
+                result = await fetch()
+            except asyncio.CancelledError:
+                future.cancel()
+                raise
+            except Exception as e:
+                result = {"success": False, "error": str(e)}
+            finally:
+                self._inflight_reads.pop(key, None)
+                
+            if result.get("success") and self.read_cache_ttl > 0:
+                self._read_cache[key] = (time.monotonic() + self.read_cache_ttl, result)
+            future.set_result(result)
+            return dict(result)
+            
+        # shield so a cancelled joiner does not cancel the shared request
+        return dict(await asyncio.shield(future))
+    
+    def _forget_read(self, key: str) -> None:
+        """Drop a remembered read so the next call goes to the node"""
+        self._read_cache.pop(key, None)
+    
     async def _handle_messages(self):
         """Handle incoming WebSocket messages"""
         if self.websocket is None:
@@ -498,9 +1221,26 @@ class InterverseChain:
         try:
             async for message in self.websocket:
                 try:
-                    data = json.loads(message)
+                    payload = message.encode("utf-8") if isinstance(message, str) else message
+                    self.socket_stats["bytes_received"] += len(payload)
+                    if isinstance(message, bytes) and is_compressed_frame(message):
+                        payload = decompress_frame(message)
+                    self.socket_stats["messages_received"] += 1
+                    self.socket_stats["bytes_decoded"] += len(payload)
+                    
+                    if isinstance(message, bytes) and peek_record_type(payload) is not None:
+                        data = decode_event(payload)
+                        if data is None:
+                            logger.warning(f"Unsupported binary WebSocket frame ({len(message)} bytes)")
+                            continue
+                    else:
+                        data = json.loads(payload)
                     logger.debug(f"WebSocket message received: {message[:100]}...")
                     
+                    sequence = data.get("seq")
+                    if isinstance(sequence, int) and sequence > self.last_sequence:
+                        self.last_sequence = sequence
+                    
                     # Broadcast raw message event
                     self._trigger_event("websocket_message", {"raw": message, "data": data})
                     
@@ -508,19 +1248,30 @@ class InterverseChain:
                     message_type = data.get("type")
                     if message_type == "welcome":
                         logger.info(f"Welcome message received for game: {data.get('game_id', 'unknown')}")
+                        if data.get("resume_token"):
+                            self.resume_token = data["resume_token"]
+                        if self._handshake_sent_at is not None:
+                            self.telemetry.record("socket_round_trip", time.perf_counter() - self._handshake_sent_at, True)
+                            self._handshake_sent_at = None
                         
                     elif message_type == "asset_update" or message_type == "new_asset":
                         asset_data = data.get("asset", {})
                         owner = asset_data.get("owner", "")
+                        self.asset_cache.apply_asset(asset_data)
+                        self._forget_read(f"assets:{owner}")
                         self._trigger_event("asset_minted", {
                             "asset": asset_data,
                             "owner": owner
                         })
                         
+                    elif message_type == "asset_delta":
+                        self._apply_asset_delta(data)
+                        
                     elif message_type == "balance_update":
                         balance_data = data.get("data", {})
                         address = balance_data.get("address", "")
                         balance = balance_data.get("balance", 0.0)
+                        self._forget_read(f"balance:{address}")
                         self._trigger_event("balance_updated", {
                             "address": address,
                             "balance": balance
@@ -528,6 +1279,14 @@ class InterverseChain:
                         
                     elif message_type == "transfer_complete":
                         transfer_data = data.get("data", {})
+                        if transfer_data.get("success", False):
+                            self.asset_cache.move_asset(
+                                transfer_data.get("asset_id", ""),
+                                transfer_data.get("sender", ""),
+                                transfer_data.get("recipient", ""))
+                            self._forget_read(f"assets:{transfer_data.get('sender', '')}")
+                            self._forget_read(f"assets:{transfer_data.get('recipient', '')}")
+                            self._log_transfer(transfer_data)
                         self._trigger_event("transfer_complete", {
                             "asset_id": transfer_data.get("asset_id", ""),
                             "from_address": transfer_data.get("sender", ""),
@@ -537,6 +1296,8 @@ class InterverseChain:
                         
                 except json.JSONDecodeError:
                     logger.warning(f"Invalid JSON in WebSocket message: {message[:100]}...")
+                except CodecError as e:
+                    logger.warning(f"Invalid binary WebSocket frame: {e}")
                     
         except websockets.exceptions.ConnectionClosed:
             logger.warning("WebSocket connection closed")
@@ -549,19 +1310,75 @@ class InterverseChain:
             self.is_connected = False
             await self._attempt_reconnect()
     
-    async def _attempt_reconnect(self):
-        """Attempt to reconnect to WebSocket with exponential backoff"""
-        if self.reconnect_attempts >= self.max_reconnect_attempts:
-            logger.error(f"Maximum reconnection attempts ({self.max_reconnect_attempts}) reached")
-            self._trigger_event("error", {"message": "Maximum reconnection attempts reached"})
+    def _log_transfer(self, transfer_data: Dict[str, Any]) -> None:
+        """Append a completed transfer event to the transaction log of sender and recipient
+        
+        Marked local; the next sync replaces it with the node's record.
+        """
+        transaction = {key: value for key, value in transfer_data.items() if key != "success"}
+        transaction["local"] = True
+        for address in {transfer_data.get("sender", ""), transfer_data.get("recipient", "")}:
+            if address and self.transaction_log.is_synced(address):
+                self.transaction_log.append(address, [transaction])
+    
+    def _apply_asset_delta(self, data: Dict[str, Any]) -> None:
+        """Merge the changed fields of an asset into the cached version and raise asset_minted"""
+        asset_id = data.get("asset_id", "")
+        changes = data.get("changes", {})
+        cached = self.asset_cache.find_asset(asset_id)
+        owner = changes.get("owner") or data.get("owner") or (cached or {}).get("owner", "")
+        self._forget_read(f"assets:{owner}")
+        
+        if cached is None:
+            # Nothing to apply the delta to; syncing the owner's list brings the whole asset.
+            # Done in a task so the receive loop is not held up by the request.
+            if not owner:
+                logger.warning(f"Asset delta for unknown asset {asset_id} without owner, ignoring")
+                return
+            asyncio.create_task(self._resync_asset(owner, asset_id))
             return
             
-        self.reconnect_attempts += 1
-        backoff = self.reconnect_delay * (2 ** (self.reconnect_attempts - 1))
+        metadata = dict(cached.get("metadata", {}))
+        metadata.update(changes.get("metadata", {}))
+        for key in data.get("removed_metadata", []):
+            metadata.pop(key, None)
+        asset_data = {**cached, **changes, "owner": owner, "metadata": metadata}
+        self.asset_cache.apply_asset(asset_data)
+        self._trigger_event("asset_minted", {
+            "asset": asset_data,
+            "owner": owner
+        })
+    
+    async def _resync_asset(self, owner: str, asset_id: str) -> None:
+        result = await self.get_player_assets(owner)
+        for asset_data in result.get("assets", []):
+            if AssetCache._asset_id(asset_data) == asset_id:
+                self._trigger_event("asset_minted", {
+                    "asset": asset_data,
+                    "owner": owner
+                })
+                return
+    
+    async def _attempt_reconnect(self):
+        """Attempt to reconnect to WebSocket with exponential backoff
         
-        logger.info(f"Attempting reconnect in {backoff} seconds (attempt {self.reconnect_attempts})")
-        await asyncio.sleep(backoff)
-        await self.connect()
+        The delay is jittered between half and all of the backoff step so
+        clients that lost the node at the same time do not return together.
+        """
+        while self.reconnect_attempts < self.max_reconnect_attempts:
+            step = min(self.max_reconnect_delay,
+                       self.reconnect_delay * (2 ** self.reconnect_attempts))
+            backoff = step / 2 + random.uniform(0, step / 2)
+            self.reconnect_attempts += 1
+            self.telemetry.reconnects += 1
+            
+            logger.info(f"Attempting reconnect in {backoff:.1f} seconds (attempt {self.reconnect_attempts})")
+            await asyncio.sleep(backoff)
+            if await self.connect():
+                return
+                
+        logger.error(f"Maximum reconnection attempts ({self.max_reconnect_attempts}) reached")
+        self._trigger_event("error", {"message": "Maximum reconnection attempts reached"})
     
     async def ensure_initialized(self) -> bool:
         """Ensure HTTP session is initialized"""
@@ -581,18 +1398,78 @@ class InterverseChain:
                 self.event_handlers[event_name].remove(callback)
     
     def _trigger_event(self, event_name: str, data: Any) -> None:
-        """Trigger event handlers"""
-        if event_name in self.event_handlers:
-            for handler in self.event_handlers[event_name]:
-                try:
-                    handler(data)
-                except Exception as e:
-                    logger.error(f"Error in event handler for {event_name}: {e}")
+        """Trigger event handlers, inline or through the dispatcher task (dispatch_events_inline)"""
+        handlers = self.event_handlers.get(event_name)
+        if not handlers:
+            return
+            
+        if self.dispatch_events_inline:
+            for handler in handlers:
+                self._call_handler(event_name, handler, data)
+            return
+            
+        if self._event_task is None or self._event_task.done():
+            try:
+                self._event_queue = asyncio.Queue(maxsize=self.max_pending_events)
+                self._event_task = asyncio.get_running_loop().create_task(self._dispatch_events())
+            except RuntimeError:  # No running loop
+                for handler in handlers:
+                    self._call_handler(event_name, handler, data)
+                return
+            
+        try:
+            # The handler list is copied so on/off during dispatch only affects later events
+            self._event_queue.put_nowait((event_name, list(handlers), data))
+        except asyncio.QueueFull:
+            self.socket_stats["events_dropped"] += 1
+            logger.warning(f"Event queue full, dropping {event_name} event")
+    
+    def _call_handler(self, event_name: str, handler: Callable, data: Any) -> Optional[Any]:
+        """Call one handler; returns the awaitable of a coroutine handler"""
+        try:
+            result = handler(data)
+            if asyncio.iscoroutine(result):
+                if self.dispatch_events_inline:
+                    return asyncio.ensure_future(result)
+                return result
+        except Exception as e:
+            logger.error(f"Error in event handler for {event_name}: {e}")
+        return None
+    
+    async def _dispatch_events(self) -> None:
+        """Run queued handler calls in order, a whole batch per wake-up
+        
+        Coroutine handlers are awaited here, off the receive loop. Blocking
+        work in a plain handler still holds the event loop while it runs;
+        move it to ``loop.run_in_executor``.
+        """
+        queue = self._event_queue
+        while True:
+            batch = [await queue.get()]
+            while not queue.empty():
+                batch.append(queue.get_nowait())
+            for event_name, handlers, data in batch:
+                for handler in handlers:
+                    pending = self._call_handler(event_name, handler, data)
+                    if pending is not None:
+                        try:
+                            await pending
+                        except Exception as e:
+                            logger.error(f"Error in event handler for {event_name}: {e}")
     
     async def close(self) -> None:
         """Close all connections and clean up resources"""
         await self.disconnect()
         
+        if self._outbox_task is not None:
+            self._outbox_task.cancel()
+            self._outbox_task = None
+        self.outbox.close()
+        
+        if self._event_task is not None:
+            self._event_task.cancel()
+            self._event_task = None
+        
         if self.http_session is not None and not self.http_session.closed:
             await self.http_session.close()
             self.http_session = None
@@ -0,0 +1,411 @@
+"""
+Compact binary encoding shared with the Unreal FInterverseBinaryCodec.
+
+Every record starts with b"IV", the format version and a record type. Map keys
+are written once into a key table and referenced by index, integers are LEB128
+varints (zigzag for signed values), floats are little-endian float32 and dates
+are unix milliseconds with 0 meaning unset.
+
+WebSocket events are sent as EVENT frames: the EVENT header, the event's
+sequence number as a varint and the ASSET, BALANCE or TRANSACTION record.
+"""
+
+import struct
+import zlib
+from datetime import datetime, timezone
+from enum import IntEnum
+from typing import Dict, Any, List, Optional, Tuple
+
+from .asset import ItemCategory, Rarity
+from .schema import Field, RecordSchema
+
+VERSION = 1
+MAGIC = b"IV"
+COMPRESSED_MAGIC = b"IZ"
+MAX_INFLATED_FRAME_SIZE = 16 * 1024 * 1024
+
+class RecordType(IntEnum):
+    """Record types, must match EInterverseBinaryRecord"""
+    PROPERTIES = 1
+    ASSET = 2
+    TRANSACTION = 3
+    BALANCE = 4
+    ASSET_LIST = 5
+    EVENT = 6
+
+# Enum order matches the Unreal EInterverseItemCategory/EInterverseRarity
+_CATEGORIES = list(ItemCategory)
+_RARITIES = list(Rarity)
+
+
+class CodecError(ValueError):
+    """Raised when binary data is truncated, corrupt or of an unsupported version"""
+
+
+def peek_record_type(data: bytes) -> Optional[RecordType]:
+    """Get the record type of encoded data, or None if it is not a supported record"""
+    if len(data) < 4 or data[:2] != MAGIC or data[2] != VERSION:
+        return None
+    try:
+        return RecordType(data[3])
+    except ValueError:
+        return None
+
+
+class _Writer:
+    def __init__(self, record_type: RecordType):
+        self.buffer = bytearray(MAGIC)
+        self.buffer.append(VERSION)
+        self.buffer.append(record_type)
+
+    def byte(self, value: int) -> None:
+        self.buffer.append(value & 0xFF)
+
+    def varint(self, value: int) -> None:
+        while True:
+            next_byte = value & 0x7F
+            value >>= 7
+            if value:
+                self.buffer.append(next_byte | 0x80)
+            else:
+                self.buffer.append(next_byte)
+                return
+
+    def signed(self, value: int) -> None:
+        self.varint((value << 1) ^ (value >> 63))
+
+    def float(self, value: float) -> None:
+        self.buffer += struct.pack("<f", float(value))
+
+    def string(self, value: Optional[str]) -> None:
+        encoded = (value or "").encode("utf-8")
+        self.varint(len(encoded))
+        self.buffer += encoded
+
+    def color(self, value: Dict[str, float]) -> None:
+        for channel in ("r", "g", "b", "a"):
+            self.float(value.get(channel, 1.0))
+
+    def date(self, value: Any) -> None:
+        self.signed(_to_unix_ms(value))
+
+    def key_table(self, keys: List[str]) -> Dict[str, int]:
+        self.varint(len(keys))
+        for key in keys:
+            self.string(key)
+        return {key: index for index, key in enumerate(keys)}
+
+    def string_map(self, values: Dict[str, Any], keys: Dict[str, int]) -> None:
+        self.varint(len(values))
+        for key, value in values.items():
+            self.varint(keys[key])
+            self.string(str(value))
+
+
+class _Reader:
+    def __init__(self, data: bytes, record_type: RecordType):
+        if peek_record_type(data) != record_type:
+            raise CodecError(f"Expected {record_type.name} record")
+        self.data = memoryview(data)
+        self.offset = 4
+
+    def byte(self) -> int:
+        if self.offset >= len(self.data):
+            raise CodecError("Unexpected end of data")
+        value = self.data[self.offset]
+        self.offset += 1
+        return value
+
+    def varint(self) -> int:
+        value = 0
+        for shift in range(0, 64, 7):
+            next_byte = self.byte()
+            value |= (next_byte & 0x7F) << shift
+            if not next_byte & 0x80:
+                return value
+        raise CodecError("Varint too long")
+
+    def signed(self) -> int:
+        value = self.varint()
+        return (value >> 1) ^ -(value & 1)
+
+    def float(self) -> float:
+        if self.offset + 4 > len(self.data):
+            raise CodecError("Unexpected end of data")
+        (value,) = struct.unpack_from("<f", self.data, self.offset)
+        self.offset += 4
+        return value
+
+    def string(self) -> str:
+        length = self.varint()
+        if self.offset + length > len(self.data):
+            raise CodecError("Unexpected end of data")
+        value = bytes(self.data[self.offset:self.offset + length]).decode("utf-8")
+        self.offset += length
+        return value
+
+    def color(self) -> Dict[str, float]:
+        return {channel: self.float() for channel in ("r", "g", "b", "a")}
+
+    def date(self) -> Optional[str]:
+        return _from_unix_ms(self.signed())
+
+    def count(self) -> int:
+        value = self.varint()
+        if value > len(self.data) - self.offset:
+            raise CodecError("Count exceeds remaining data")
+        return value
+
+    def key_table(self) -> List[str]:
+        return [self.string() for _ in range(self.count())]
+
+    def key(self, keys: List[str]) -> str:
+        index = self.varint()
+        if index >= len(keys):
+            raise CodecError("Key index out of range")
+        return keys[index]
+
+    def string_map(self, keys: List[str]) -> Dict[str, str]:
+        result = {}
+        for _ in range(self.count()):
+            key = self.key(keys)
+            result[key] = self.string()
+        return result
+
+
+def _to_unix_ms(value: Any) -> int:
+    if not value:
+        return 0
+    if isinstance(value, (int, float)):
+        return int(value * 1000)
+    if isinstance(value, str):
+        value = datetime.fromisoformat(value.replace('Z', '+00:00'))
+    if value.tzinfo is None:
+        value = value.replace(tzinfo=timezone.utc)
+    return int(value.timestamp() * 1000)
+
+
+def _from_unix_ms(value: int) -> Optional[str]:
+    if value == 0:
+        return None
+    return datetime.fromtimestamp(value / 1000, tz=timezone.utc).isoformat().replace('+00:00', 'Z')
+
+
+def _keys_of(*maps: Dict[str, Any]) -> List[str]:
+    keys: Dict[str, None] = {}
+    for values in maps:
+        for key in values:
+            keys.setdefault(key, None)
+    return list(keys)
+
+
+# Field order is the binary layout and must match InterverseSchema.h
+PROPERTIES_RECORD = RecordSchema("properties", [
+    Field("category", "enum", ItemCategory.COSMETIC, enum=_CATEGORIES, enum_default=5),
+    Field("rarity", "enum", Rarity.COMMON, enum=_RARITIES),
+    Field("level", "int", 1),
+    Field("model_id", "string", ""),
+    Field("primary_color", "color"),
+    Field("secondary_color", "color"),
+    Field("numeric_properties", "float_map"),
+    Field("string_properties", "string_map"),
+    Field("tags", "string_list"),
+    Field("owner_global_id", "string", "", omit_empty=True),
+    Field("target_player_id", "string", "", omit_empty=True),
+])
+
+ASSET_RECORD = RecordSchema("asset", [
+    Field("asset_id", "string", "", aliases=("id",)),
+    Field("owner", "string", ""),
+    Field("owner_global_id", "string", ""),
+    Field("category", "enum", "cosmetic", aliases=("asset_type",), enum=_CATEGORIES, enum_default=5),
+    Field("rarity", "enum", "common", enum=_RARITIES),
+    Field("metadata", "string_map"),
+    Field("game_id", "string", ""),
+    Field("created_at", "date"),
+    Field("modified_at", "date"),
+])
+
+TRANSACTION_RECORD = RecordSchema("transaction", [
+    Field("id", "string", ""),
+    Field("sender_address", "string", ""),
+    Field("recipient_address", "string", ""),
+    Field("amount", "float", 0.0),
+    Field("transaction_type", "text", "TRANSFER"),
+    Field("status", "text", "pending"),
+    Field("timestamp", "date"),
+    Field("metadata", "string_map"),
+])
+
+
+def encode_properties(properties: Dict[str, Any]) -> bytes:
+    """Encode a properties dict (InterverseAsset.to_dict format) as a PROPERTIES record"""
+    writer = _Writer(RecordType.PROPERTIES)
+    keys = writer.key_table(_keys_of(*PROPERTIES_RECORD.map_fields(properties)))
+    PROPERTIES_RECORD.write(writer, properties, keys)
+
+    # Identity block; FInterverseBaseProperties has no such fields and skips it
+    identity = [properties.get(field) for field in ("asset_id", "owner", "game_id")]
+    if any(identity):
+        writer.byte(1)
+        for value in identity:
+            writer.string(value)
+    else:
+        writer.byte(0)
+
+    return bytes(writer.buffer)
+
+
+def decode_properties(data: bytes) -> Dict[str, Any]:
+    """Decode a PROPERTIES record into the InterverseAsset.to_dict format"""
+    reader = _Reader(data, RecordType.PROPERTIES)
+    keys = reader.key_table()
+    result = PROPERTIES_RECORD.read(reader, keys)
+
+    if reader.byte():
+        for field in ("asset_id", "owner", "game_id"):
+            value = reader.string()
+            if value:
+                result[field] = value
+
+    return result
+
+
+def encode_asset(asset: Dict[str, Any]) -> bytes:
+    """Encode an asset in API format as an ASSET record; metadata values are stored as strings"""
+    writer = _Writer(RecordType.ASSET)
+    keys = writer.key_table(_keys_of(*ASSET_RECORD.map_fields(asset)))
+    ASSET_RECORD.write(writer, asset, keys)
+    return bytes(writer.buffer)
+
+
+def decode_asset(data: bytes) -> Dict[str, Any]:
+    """Decode an ASSET record into API format"""
+    reader = _Reader(data, RecordType.ASSET)
+    keys = reader.key_table()
+    return ASSET_RECORD.read(reader, keys)
+
+
+def encode_asset_list(assets: List[Dict[str, Any]], synced_up_to: Any = None) -> bytes:
+    """Encode assets sharing one key table as an ASSET_LIST record"""
+    writer = _Writer(RecordType.ASSET_LIST)
+    writer.date(synced_up_to)
+    keys = writer.key_table(_keys_of(*(values for asset in assets for values in ASSET_RECORD.map_fields(asset))))
+    writer.varint(len(assets))
+    for asset in assets:
+        ASSET_RECORD.write(writer, asset, keys)
+    return bytes(writer.buffer)
+
+
+def decode_asset_list(data: bytes) -> Tuple[List[Dict[str, Any]], Optional[str]]:
+    """Decode an ASSET_LIST record, returns (assets, synced_up_to)"""
+    reader = _Reader(data, RecordType.ASSET_LIST)
+    synced_up_to = reader.date()
+    keys = reader.key_table()
+    assets = [ASSET_RECORD.read(reader, keys) for _ in range(reader.count())]
+    return assets, synced_up_to
+
+
+def encode_transaction(transaction: Dict[str, Any]) -> bytes:
+    """Encode a transaction dict (Transaction.to_dict format) as a TRANSACTION record"""
+    writer = _Writer(RecordType.TRANSACTION)
+    keys = writer.key_table(_keys_of(*TRANSACTION_RECORD.map_fields(transaction)))
+    TRANSACTION_RECORD.write(writer, transaction, keys)
+    return bytes(writer.buffer)
+
+
+def decode_transaction(data: bytes) -> Dict[str, Any]:
+    """Decode a TRANSACTION record into the Transaction.to_dict format"""
+    reader = _Reader(data, RecordType.TRANSACTION)
+    keys = reader.key_table()
+    return TRANSACTION_RECORD.read(reader, keys)
+
+
+def encode_balance(address: str, balance: float) -> bytes:
+    """Encode a balance update as a BALANCE record"""
+    writer = _Writer(RecordType.BALANCE)
+    writer.string(address)
+    writer.float(balance)
+    return bytes(writer.buffer)
+
+
+def decode_balance(data: bytes) -> Tuple[str, float]:
+    """Decode a BALANCE record, returns (address, balance)"""
+    reader = _Reader(data, RecordType.BALANCE)
+    return reader.string(), reader.float()
+
+
+def encode_event_frame(sequence: int, record: bytes) -> bytes:
+    """Wrap an encoded event record into an EVENT frame with the event's sequence number"""
+    writer = _Writer(RecordType.EVENT)
+    writer.varint(sequence)
+    writer.buffer += record
+    return bytes(writer.buffer)
+
+
+def decode_event_frame(data: bytes) -> Tuple[int, bytes]:
+    """Split an EVENT frame, returns (sequence, record)"""
+    reader = _Reader(data, RecordType.EVENT)
+    sequence = reader.varint()
+    record = bytes(reader.data[reader.offset:])
+    if peek_record_type(record) in (None, RecordType.EVENT):
+        raise CodecError("EVENT frame without an event record")
+    return sequence, record
+
+
+def decode_event(data: bytes) -> Optional[Dict[str, Any]]:
+    """Turn a binary WebSocket frame into the equivalent JSON message dict"""
+    record_type = peek_record_type(data)
+
+    if record_type == RecordType.EVENT:
+        sequence, record = decode_event_frame(data)
+        event = decode_event(record)
+        if event is not None:
+            event["seq"] = sequence
+        return event
+
+    if record_type == RecordType.ASSET:
+        return {"type": "asset_update", "asset": decode_asset(data)}
+
+    if record_type == RecordType.BALANCE:
+        address, balance = decode_balance(data)
+        return {"type": "balance_update", "data": {"address": address, "balance": balance}}
+
+    if record_type == RecordType.TRANSACTION:
+        transaction = decode_transaction(data)
+        return {"type": "transfer_complete", "data": {
+            "transaction_id": transaction["id"],
+            "asset_id": transaction["metadata"].get("asset_id", ""),
+            "sender": transaction["sender_address"],
+            "recipient": transaction["recipient_address"],
+            "success": transaction["status"] == "completed"
+        }}
+
+    return None
+
+
+def is_compressed_frame(data: bytes) -> bool:
+    """Check for a compressed frame: b"IZ", the version, the uint32 LE inflated size and a zlib stream"""
+    return len(data) >= 7 and data[:2] == COMPRESSED_MAGIC and data[2] == VERSION
+
+
+def compress_frame(payload: bytes) -> bytes:
+    """Wrap a binary record or UTF-8 JSON message into a compressed frame"""
+    return COMPRESSED_MAGIC + bytes([VERSION]) + struct.pack("<I", len(payload)) + zlib.compress(payload)
+
+
+def decompress_frame(data: bytes) -> bytes:
+    """Get the payload of a compressed frame"""
+    if not is_compressed_frame(data):
+        raise CodecError("Not a compressed frame")
+    (size,) = struct.unpack_from("<I", data, 3)
+    if size > MAX_INFLATED_FRAME_SIZE:
+        raise CodecError(f"Compressed frame too large ({size} bytes)")
+    try:
+        # Bounded so a corrupt or hostile frame cannot inflate past its announced size
+        payload = zlib.decompressobj().decompress(data[7:], size)
+    except zlib.error as e:
+        raise CodecError(f"Corrupt compressed frame: {e}")
+    if len(payload) != size:
+        raise CodecError("Compressed frame size mismatch")
+    return payload
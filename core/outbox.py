@@ -0,0 +1,112 @@
+import json
+import os
+import uuid
+import logging
+from datetime import datetime, timezone
+from typing import Dict, Any, Optional, List
+
+logger = logging.getLogger("interverse.outbox")
+
+# Rewrite the journal with only the open entries after this many acks
+COMPACT_AFTER_ACKS = 256
+
+class Outbox:
+    """Write-ahead journal of mints and transfers not yet confirmed by the node
+
+    Every operation is appended to the journal and flushed to disk before it
+    is sent, under an idempotency key that is sent with it. Operations whose
+    response was lost can be resent after a restart without being applied
+    twice. Without a path the outbox only lives in memory.
+    """
+
+    def __init__(self, path: Optional[str] = None):
+        self.path = path
+        self.entries: List[Dict[str, Any]] = []
+        self._acks_since_compaction = 0
+        self._journal = None
+
+        if self.path:
+            directory = os.path.dirname(self.path)
+            if directory:
+                os.makedirs(directory, exist_ok=True)
+            self._replay()
+            self._compact()
+            if self.entries:
+                logger.info(f"Recovered {len(self.entries)} unconfirmed operations from {self.path}")
+
+    def __len__(self) -> int:
+        return len(self.entries)
+
+    def enqueue(self, op: str, endpoint: str, payload: Dict[str, Any]) -> str:
+        """Journal an operation and return its idempotency key"""
+        entry = {
+            "add": str(uuid.uuid4()),
+            "op": op,
+            "endpoint": endpoint,
+            "payload": payload,
+            "created_at": datetime.now(timezone.utc).isoformat()
+        }
+        self.entries.append(entry)
+        self._append(entry)
+        return entry["add"]
+
+    def peek(self, max_entries: int) -> List[Dict[str, Any]]:
+        """Oldest open entries first"""
+        return list(self.entries[:max_entries])
+
+    def acknowledge(self, key: str) -> None:
+        """Mark an operation as answered by the node"""
+        remaining = [entry for entry in self.entries if entry["add"] != key]
+        if len(remaining) == len(self.entries):
+            return
+        self.entries = remaining
+        self._append({"ack": key})
+
+        self._acks_since_compaction += 1
+        if self._acks_since_compaction >= COMPACT_AFTER_ACKS:
+            self._compact()
+
+    def close(self) -> None:
+        """Close the journal file"""
+        if self._journal is not None:
+            self._journal.close()
+            self._journal = None
+
+    def _replay(self) -> None:
+        if not os.path.exists(self.path):
+            return
+        with open(self.path, "r", encoding="utf-8") as f:
+            for line in f:
+                try:
+                    record = json.loads(line)
+                except json.JSONDecodeError:
+                    continue  # Torn last line after a crash
+                if "ack" in record:
+                    self.entries = [entry for entry in self.entries if entry["add"] != record["ack"]]
+                elif "add" in record:
+                    self.entries.append(record)
+
+    def _append(self, record: Dict[str, Any]) -> None:
+        if self._journal is None:
+            return
+        self._journal.write(json.dumps(record) + "\n")
+        self._journal.flush()
+        os.fsync(self._journal.fileno())
+
+    def _compact(self) -> None:
+        if not self.path:
+            return
+        self.close()
+
+        # Replace atomically so a crash never leaves a half-written journal
+        temp_path = self.path + ".tmp"
+        try:
+            with open(temp_path, "w", encoding="utf-8") as f:
+                for entry in self.entries:
+                    f.write(json.dumps(entry) + "\n")
+            os.replace(temp_path, self.path)
+        except OSError as e:
+            logger.warning(f"Failed to compact outbox journal {self.path}: {e}")
+        self._acks_since_compaction = 0
+
+        self._journal = open(self.path, "a", encoding="utf-8")
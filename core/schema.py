@@ -0,0 +1,191 @@
+"""
+Field tables of the Interverse records, shared by the JSON and binary paths.
+
+A RecordSchema lists the fields of a record once, in binary order, with their
+API names, aliases and defaults; it must match the TInterverseSchema
+specializations of the Unreal SDK (InterverseSchema.h). The reader, writer and
+normalizer of every schema are built from per-field closures when the schema is
+created, so decoding a record runs one precomputed reader per field with no
+per-field lookups or type dispatch at runtime.
+"""
+
+from typing import Dict, Any, Callable, List, NamedTuple, Optional, Tuple
+
+_KINDS = ("string", "text", "float", "int", "enum", "color", "date", "string_map", "float_map", "string_list")
+_MAP_KINDS = ("string_map", "float_map")
+# Kinds whose missing or empty value is written as an empty container
+_CONTAINER_DEFAULTS = {"string_map": dict, "float_map": dict, "color": dict, "string_list": list}
+
+
+class Field(NamedTuple):
+    """One field of a record. enum is the list of members for the "enum" kind, indexed by their byte value."""
+    name: str
+    kind: str
+    default: Any = None
+    aliases: Tuple[str, ...] = ()
+    enum: Optional[list] = None
+    enum_default: int = 0
+    omit_empty: bool = False
+
+
+def _text(value: Any) -> str:
+    return str(getattr(value, "value", value))
+
+
+def _enum_index(members: list, value: Any, default: int) -> int:
+    try:
+        return members.index(type(members[0]).from_string(_text(value)))
+    except (ValueError, AttributeError):
+        return default
+
+
+def _enum_value(members: list, index: int, default: int) -> str:
+    return members[index if index < len(members) else default].value
+
+
+def _write_float_map(writer: Any, values: Dict[str, float], keys: Dict[str, int]) -> None:
+    writer.varint(len(values))
+    for key, value in values.items():
+        writer.varint(keys[key])
+        writer.float(value)
+
+
+def _read_float_map(reader: Any, keys: List[str]) -> Dict[str, float]:
+    values = {}
+    for _ in range(reader.count()):
+        key = reader.key(keys)
+        values[key] = reader.float()
+    return values
+
+
+def _write_string_list(writer: Any, values: List[str]) -> None:
+    writer.varint(len(values))
+    for value in values:
+        writer.string(value)
+
+
+def _read_string_list(reader: Any) -> List[str]:
+    return [reader.string() for _ in range(reader.count())]
+
+
+def _make_writer(field: Field) -> Callable[[Any, Any, Dict[str, int]], None]:
+    """Writes one value of the field's kind: writer(writer, value, keys)"""
+    kind, members, enum_default = field.kind, field.enum, field.enum_default
+    if kind == "string":
+        return lambda writer, value, keys: writer.string(value)
+    if kind == "text":
+        return lambda writer, value, keys: writer.string(_text(value))
+    if kind == "float":
+        return lambda writer, value, keys: writer.float(value)
+    if kind == "int":
+        return lambda writer, value, keys: writer.signed(int(value))
+    if kind == "enum":
+        return lambda writer, value, keys: writer.byte(_enum_index(members, value, enum_default))
+    if kind == "color":
+        return lambda writer, value, keys: writer.color(value)
+    if kind == "date":
+        return lambda writer, value, keys: writer.date(value)
+    if kind == "string_map":
+        return lambda writer, value, keys: writer.string_map(value, keys)
+    if kind == "float_map":
+        return _write_float_map
+    if kind == "string_list":
+        return lambda writer, value, keys: _write_string_list(writer, value)
+    raise ValueError(f"unknown field kind {kind!r}")
+
+
+def _make_reader(field: Field) -> Callable[[Any, List[str]], Any]:
+    """Reads one value of the field's kind: reader(reader, keys)"""
+    kind, members, enum_default = field.kind, field.enum, field.enum_default
+    if kind in ("string", "text"):
+        return lambda reader, keys: reader.string()
+    if kind == "float":
+        return lambda reader, keys: reader.float()
+    if kind == "int":
+        return lambda reader, keys: reader.signed()
+    if kind == "enum":
+        return lambda reader, keys: _enum_value(members, reader.byte(), enum_default)
+    if kind == "color":
+        return lambda reader, keys: reader.color()
+    if kind == "date":
+        return lambda reader, keys: reader.date()
+    if kind == "string_map":
+        return lambda reader, keys: reader.string_map(keys)
+    if kind == "float_map":
+        return _read_float_map
+    if kind == "string_list":
+        return lambda reader, keys: _read_string_list(reader)
+    raise ValueError(f"unknown field kind {kind!r}")
+
+
+def _make_getter(field: Field) -> Callable[[Dict[str, Any]], Any]:
+    """Value of the field in an API dict, resolving aliases and the default"""
+    name, default = field.name, field.default
+    empty = _CONTAINER_DEFAULTS.get(field.kind)
+
+    # Aliases are tried in order; the fallback of a field with aliases applies to falsy values as well
+    if field.aliases:
+        names = (name, *field.aliases)
+
+        def get(data: Dict[str, Any]) -> Any:
+            for key in names:
+                value = data.get(key)
+                if value:
+                    return value
+            return default
+    else:
+        def get(data: Dict[str, Any]) -> Any:
+            return data.get(name, default)
+
+    if empty is None:
+        return get
+    return lambda data: get(data) or empty()
+
+
+class RecordSchema:
+    """Codec of one record type, built from its field table.
+
+    write(writer, record, keys) writes the record body, read(reader, keys) returns it as a dict in API
+    format, normalize(data) resolves aliases, defaults and enum spellings of an API dict and
+    map_fields(record) returns the maps whose keys go into the record's key table.
+    """
+
+    def __init__(self, name: str, fields: List[Field]):
+        self.name = name
+        self.fields = tuple(fields)
+        for field in self.fields:
+            if field.kind not in _KINDS:
+                raise ValueError(f"{self.name}.{field.name}: unknown field kind {field.kind!r}")
+
+        getters = tuple(_make_getter(field) for field in self.fields)
+        self._writers = tuple(zip(getters, (_make_writer(field) for field in self.fields)))
+        self._readers = tuple((field.name, _make_reader(field)) for field in self.fields)
+        self._omitted = tuple(field.name for field in self.fields if field.omit_empty)
+        self._normalizers = tuple((field.name, self._make_normalizer(field, getter))
+                                  for field, getter in zip(self.fields, getters))
+        self._map_getters = tuple(getter for field, getter in zip(self.fields, getters) if field.kind in _MAP_KINDS)
+
+    @staticmethod
+    def _make_normalizer(field: Field, getter: Callable[[Dict[str, Any]], Any]) -> Callable[[Dict[str, Any]], Any]:
+        if field.kind != "enum":
+            return getter
+        members, enum_default = field.enum, field.enum_default
+        return lambda data: _enum_value(members, _enum_index(members, getter(data), enum_default), enum_default)
+
+    def write(self, writer: Any, record: Dict[str, Any], keys: Dict[str, int]) -> None:
+        for get, write in self._writers:
+            write(writer, get(record), keys)
+
+    def read(self, reader: Any, keys: List[str]) -> Dict[str, Any]:
+        # Fields are read in binary order, which is the order of the table
+        record = {name: read(reader, keys) for name, read in self._readers}
+        for name in self._omitted:
+            if not record[name]:
+                del record[name]
+        return record
+
+    def normalize(self, data: Dict[str, Any]) -> Dict[str, Any]:
+        return {name: normalize(data) for name, normalize in self._normalizers}
+
+    def map_fields(self, record: Dict[str, Any]) -> Tuple[Dict[str, Any], ...]:
+        return tuple(get(record) for get in self._map_getters)
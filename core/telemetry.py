@@ -0,0 +1,131 @@
+import math
+import time
+import functools
+import aiohttp
+from typing import Dict, Any, List
+
+# Histogram buckets grow by 20% from 0.5 ms, which covers a few minutes in 72 buckets
+FIRST_BUCKET_MS = 0.5
+BUCKET_GROWTH = 1.2
+NUM_BUCKETS = 72
+
+class LatencyHistogram:
+    """Latency histogram with logarithmic buckets
+
+    Recording is constant time and memory; percentiles are the upper bound
+    of the bucket they fall into, so they are accurate to about 20%.
+    """
+
+    def __init__(self):
+        self.buckets = [0] * NUM_BUCKETS
+        self.count = 0
+        self.max_ms = 0.0
+
+    def record(self, milliseconds: float) -> None:
+        milliseconds = max(0.0, milliseconds)
+        bucket = 0
+        if milliseconds > FIRST_BUCKET_MS:
+            bucket = math.ceil(math.log(milliseconds / FIRST_BUCKET_MS) / math.log(BUCKET_GROWTH))
+        self.buckets[min(bucket, NUM_BUCKETS - 1)] += 1
+        self.count += 1
+        self.max_ms = max(self.max_ms, milliseconds)
+
+    def percentile(self, fraction: float) -> float:
+        if self.count == 0:
+            return 0.0
+        rank = max(1, math.ceil(min(max(fraction, 0.0), 1.0) * self.count))
+        seen = 0
+        for bucket, samples in enumerate(self.buckets):
+            seen += samples
+            if seen >= rank:
+                return min(FIRST_BUCKET_MS * BUCKET_GROWTH ** bucket, self.max_ms)
+        return self.max_ms
+
+class Telemetry:
+    """Call counts, failures, in-flight gauges and latency per SDK operation
+
+    Also counts HTTP payload bytes through ``trace_config`` and WebSocket
+    reconnects. ``InterverseChain.get_stats`` combines it with the socket
+    counters.
+    """
+
+    def __init__(self):
+        self.operations: Dict[str, Dict[str, Any]] = {}
+        self.http_bytes_sent = 0
+        self.http_bytes_received = 0
+        self.reconnects = 0
+
+    def begin(self, operation: str) -> float:
+        """Count a call as in flight and return its start time for end()"""
+        self._operation(operation)["in_flight"] += 1
+        return time.perf_counter()
+
+    def end(self, operation: str, start: float, success: bool) -> None:
+        state = self._operation(operation)
+        state["in_flight"] = max(0, state["in_flight"] - 1)
+        self.record(operation, time.perf_counter() - start, success)
+
+    def record(self, operation: str, seconds: float, success: bool) -> None:
+        """A completed measurement that was not started through begin()"""
+        state = self._operation(operation)
+        state["count"] += 1
+        if not success:
+            state["failures"] += 1
+        state["latency"].record(seconds * 1000.0)
+
+    def trace_config(self):
+        """aiohttp TraceConfig counting request and response body bytes"""
+        async def on_request_chunk_sent(session, context, params):
+            self.http_bytes_sent += len(params.chunk)
+
+        async def on_response_chunk_received(session, context, params):
+            self.http_bytes_received += len(params.chunk)
+
+        config = aiohttp.TraceConfig()
+        config.on_request_chunk_sent.append(on_request_chunk_sent)
+        config.on_response_chunk_received.append(on_response_chunk_received)
+        return config
+
+    def get_stats(self) -> Dict[str, Any]:
+        operations: List[Dict[str, Any]] = []
+        for name, state in sorted(self.operations.items()):
+            latency = state["latency"]
+            operations.append({
+                "operation": name,
+                "count": state["count"],
+                "failures": state["failures"],
+                "in_flight": state["in_flight"],
+                "p50_ms": latency.percentile(0.50),
+                "p95_ms": latency.percentile(0.95),
+                "p99_ms": latency.percentile(0.99),
+                "max_ms": latency.max_ms
+            })
+        return {
+            "operations": operations,
+            "http_bytes_sent": self.http_bytes_sent,
+            "http_bytes_received": self.http_bytes_received,
+            "reconnects": self.reconnects
+        }
+
+    def _operation(self, operation: str) -> Dict[str, Any]:
+        state = self.operations.get(operation)
+        if state is None:
+            state = {"count": 0, "failures": 0, "in_flight": 0, "latency": LatencyHistogram()}
+            self.operations[operation] = state
+        return state
+
+def tracked(operation: str):
+    """Measure an async InterverseChain method; results with a true "success" count as succeeded"""
+    def decorator(func):
+        @functools.wraps(func)
+        async def wrapper(self, *args, **kwargs):
+            start = self.telemetry.begin(operation)
+            success = False
+            try:
+                result = await func(self, *args, **kwargs)
+                success = isinstance(result, dict) and bool(result.get("success"))
+                return result
+            finally:
+                self.telemetry.end(operation, start, success)
+        return wrapper
+    return decorator
@@ -0,0 +1,145 @@
+import json
+import os
+import hashlib
+import logging
+from typing import Dict, Any, Optional, List
+
+logger = logging.getLogger("interverse.transaction_log")
+
+
+def transaction_key(transaction: Dict[str, Any]) -> str:
+    """Identity of a transaction for deduplication, the node's id or a digest of its content"""
+    key = transaction.get("transaction_id") or transaction.get("id")
+    if key:
+        return str(key)
+    return hashlib.sha1(json.dumps(transaction, sort_keys=True, default=str).encode("utf-8")).hexdigest()
+
+
+class TransactionLog:
+    """Local append-only transaction history per wallet with a high-water mark
+
+    Transactions are only ever appended, deduplicated by id, so a sync asks
+    the node for the entries after ``synced_up_to`` and transfer events can be
+    merged in as they arrive. Entries built from events are marked
+    ``"local": True`` and replaced by the node's record of the same id when a
+    sync brings it. With a directory every wallet's log is a JSON
+    lines file in it, replayed on first use; without one the logs only live
+    in memory. A log counts as synced once it holds a complete history from
+    the node; events for wallets without one are not logged.
+    """
+
+    def __init__(self, log_dir: Optional[str] = None):
+        self.log_dir = log_dir
+        self.transactions: Dict[str, List[Dict[str, Any]]] = {}
+        self.synced_up_to: Dict[str, str] = {}
+        self._positions: Dict[str, Dict[str, int]] = {}  # transaction key -> index in the history
+        if self.log_dir:
+            os.makedirs(self.log_dir, exist_ok=True)
+
+    def is_synced(self, address: str) -> bool:
+        return address in self.synced_up_to
+
+    def get_sync_marker(self, address: str) -> Optional[str]:
+        """Timestamp to send as ``since`` for the next sync of an address"""
+        return self.synced_up_to.get(address)
+
+    def get_transactions(self, address: str) -> Optional[List[Dict[str, Any]]]:
+        """The logged history of an address in arrival order, None if it was never synced"""
+        if not self.is_synced(address):
+            return None
+        return list(self.transactions.get(address, []))
+
+    def load(self, address: str) -> bool:
+        """Replay the log file of an address"""
+        path = self._log_path(address)
+        if path is None or not os.path.exists(path):
+            return False
+
+        with open(path, "rb") as f:
+            content = f.read()
+        # Cut a torn last line after a crash so later appends start on a line of their own
+        complete = content.rfind(b"\n") + 1
+        if complete < len(content):
+            with open(path, "r+b") as f:
+                f.truncate(complete)
+
+        transactions, positions, synced_up_to = [], {}, None
+        for line in content[:complete].decode("utf-8", errors="replace").splitlines():
+            try:
+                record = json.loads(line)
+            except json.JSONDecodeError:
+                continue
+            if "tx" in record:
+                self._merge(transactions, positions, record["tx"])
+            elif "mark" in record:
+                synced_up_to = record["mark"]
+
+        if synced_up_to is None:
+            return False
+        self.transactions[address] = transactions
+        self._positions[address] = positions
+        self.synced_up_to[address] = synced_up_to
+        logger.debug(f"Loaded {len(transactions)} logged transactions for {address}")
+        return True
+
+    def append(self, address: str, transactions: List[Dict[str, Any]],
+               synced_up_to: Optional[str] = None) -> List[Dict[str, Any]]:
+        """Log the transactions not yet known and optionally move the mark
+
+        Returns the new ones and the node records that replaced local entries.
+        Only a sync response moves the mark; events may arrive out of order and
+        are covered by the deduplication on the next sync.
+        """
+        positions = self._positions.setdefault(address, {})
+        history = self.transactions.setdefault(address, [])
+        added = [transaction for transaction in transactions if self._merge(history, positions, transaction)]
+
+        if synced_up_to is not None:
+            self.synced_up_to[address] = synced_up_to
+
+        records = [{"tx": transaction} for transaction in added]
+        if synced_up_to is not None:
+            records.append({"mark": synced_up_to})
+        self._write(address, records)
+        return added
+
+    def invalidate(self, address: str) -> None:
+        """Forget the history of an address so the next sync downloads all of it"""
+        self.transactions.pop(address, None)
+        self._positions.pop(address, None)
+        self.synced_up_to.pop(address, None)
+        path = self._log_path(address)
+        if path is not None and os.path.exists(path):
+            os.remove(path)
+
+    @staticmethod
+    def _merge(history: List[Dict[str, Any]], positions: Dict[str, int], transaction: Dict[str, Any]) -> bool:
+        """Add a transaction or replace the local entry of its id, False if it is already logged"""
+        key = transaction_key(transaction)
+        position = positions.get(key)
+        if position is None:
+            positions[key] = len(history)
+            history.append(transaction)
+            return True
+        if history[position].get("local") and not transaction.get("local"):
+            history[position] = transaction
+            return True
+        return False
+
+    def _write(self, address: str, records: List[Dict[str, Any]]) -> None:
+        path = self._log_path(address)
+        if path is None or not records:
+            return
+        try:
+            with open(path, "a", encoding="utf-8") as f:
+                f.write("".join(json.dumps(record) + "\n" for record in records))
+                f.flush()
+                os.fsync(f.fileno())
+        except OSError as e:
+            logger.warning(f"Failed to append to transaction log {path}: {e}")
+
+    def _log_path(self, address: str) -> Optional[str]:
+        if not self.log_dir:
+            return None
+        safe_name = "".join(c for c in address if c.isalnum() or c in "-_")
+        return os.path.join(self.log_dir, f"{safe_name}.jsonl")
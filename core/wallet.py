@@ -3,9 +3,13 @@ import os
 import base64
 import hashlib
 import logging
-from typing import Dict, Any, Optional, List, Tuple
+from collections.abc import MutableMapping
+from typing import Dict, Any, Optional, List, Tuple, Iterator
 from datetime import datetime
 
+from .wallet_store import WalletStore
+from .transaction_log import transaction_key
+
 logger = logging.getLogger("interverse.wallet")
 
 class InterverseWallet:
@@ -95,8 +99,66 @@ class InterverseWallet:
         self._private_key = ""
 
 
+class _StoredWallets(MutableMapping):
+    """address -> InterverseWallet; wallets of the store are read and decrypted on first access"""
+    
+    def __init__(self, storage: 'WalletStorage'):
+        self._storage = storage
+        self._loaded: Dict[str, InterverseWallet] = {}
+    
+    def __getitem__(self, address: str) -> InterverseWallet:
+        wallet = self._loaded.get(address)
+        if wallet is None:
+            # Raises on a failed decrypt, so only readable wallets are kept
+            wallet = self._storage._read_wallet(address)
+            self._loaded[address] = wallet
+        return wallet
+    
+    def loaded(self, address: str) -> Optional[InterverseWallet]:
+        """The wallet if it was read already, without reading it"""
+        return self._loaded.get(address)
+    
+    def __setitem__(self, address: str, wallet: InterverseWallet) -> None:
+        self._loaded[address] = wallet
+    
+    def __delitem__(self, address: str) -> None:
+        # Only forgets the object; WalletStorage.delete_wallet removes it from the store
+        if self._loaded.pop(address, None) is None and address not in self._storage.store_addresses():
+            raise KeyError(address)
+    
+    def __contains__(self, address: object) -> bool:
+        return address in self._loaded or address in self._storage.store_addresses()
+    
+    def __iter__(self) -> Iterator[str]:
+        yield from self._loaded
+        for address in self._storage.store_addresses():
+            if address not in self._loaded:
+                yield address
+    
+    def __len__(self) -> int:
+        return len(self._loaded.keys() | set(self._storage.store_addresses()))
+
+
+class WalletDecryptionError(ValueError):
+    """A stored private key could not be decrypted with the key of the password"""
+
+
 class WalletStorage:
-    """Handles secure storage of wallet information"""
+    """Handles secure storage of wallet information
+    
+    Wallets live in one indexed file (see WalletStore). Loading reads only
+    the index; a wallet is read, and its private key decrypted, the first
+    time it is looked up. ``wallets`` maps every stored address, loaded or not.
+    
+    Private keys are encrypted with a key derived from the password and a
+    random salt of the store, kept next to it. Only the derived key is held
+    in memory, never the password.
+    """
+    
+    STORE_FILENAME = "wallets.ivw"
+    SALT_FILENAME = "wallets.salt"
+    # Salt of the per-wallet JSON files of older SDK versions
+    LEGACY_SALT = b'interverse-salt'
     
     def __init__(self, storage_dir: str = None):
         # Default to user's home directory if not specified
@@ -109,95 +171,213 @@ class WalletStorage:
         # Create directory if it doesn't exist
         os.makedirs(self.storage_dir, exist_ok=True)
         
-        self.wallets: Dict[str, InterverseWallet] = {}
+        self.store: Optional[WalletStore] = None
+        self.wallets = _StoredWallets(self)
+        self._key: Optional[bytes] = None
+        self._salt: Optional[bytes] = None
+        self._balances: Dict[str, float] = {}  # Refreshed balances of wallets not read yet
     
     def load_wallets(self, password: Optional[str] = None) -> int:
-        """Load all wallets from storage"""
-        count = 0
+        """Open the wallet store and import wallet files of older SDK versions
+        
+        The key derived from ``password`` decrypts private keys as wallets
+        are looked up. Returns the number of stored wallets.
+        """
         try:
-            for filename in os.listdir(self.storage_dir):
-                if filename.endswith('.json'):
-                    wallet_path = os.path.join(self.storage_dir, filename)
-                    try:
-                        with open(wallet_path, 'r') as f:
-                            wallet_data = json.load(f)
-                            
-                        # Handle encrypted files
-                        if wallet_data.get("encrypted", False) and password:
-                            wallet_data = self._decrypt_wallet_data(wallet_data, password)
-                            
-                        wallet = InterverseWallet.from_dict(wallet_data)
-                        self.wallets[wallet.address] = wallet
-                        count += 1
-                            
-                    except Exception as e:
-                        logger.error(f"Error loading wallet {filename}: {e}")
+            self._open_store()
+            self._key = self._derive_key(password, self._store_salt()) if password else None
         except Exception as e:
             logger.error(f"Error loading wallets: {e}")
+            return 0
             
-        return count
+        self._import_wallet_files(password)
+        return len(self.wallets)
     
     def save_wallet(self, wallet: InterverseWallet, password: Optional[str] = None) -> bool:
-        """Save wallet to storage"""
+        """Save wallet to storage; with a password the private key is stored encrypted"""
         try:
-            wallet_data = wallet.to_dict(include_private=True)
-            
-            # Encrypt if password provided
-            if password:
-                wallet_data = self._encrypt_wallet_data(wallet_data, password)
-            
-            filename = f"{wallet.address}.json"
-            wallet_path = os.path.join(self.storage_dir, filename)
-            
-            with open(wallet_path, 'w') as f:
-                json.dump(wallet_data, f, indent=2)
-                
-            # Add to memory cache
-            self.wallets[wallet.address] = wallet
-            return True
-                
+            key = self._derive_key(password, self._store_salt()) if password and wallet.has_private_key else None
         except Exception as e:
             logger.error(f"Error saving wallet {wallet.address}: {e}")
             return False
+        return self._save_wallet(wallet, key)
     
     def get_wallet(self, address: str) -> Optional[InterverseWallet]:
-        """Get wallet by address"""
-        return self.wallets.get(address)
+        """Get wallet by address; None if it is not stored or its private key does not decrypt"""
+        try:
+            return self.wallets.get(address)
+        except WalletDecryptionError as e:
+            logger.error(str(e))
+            return None
     
     def get_all_wallets(self) -> List[InterverseWallet]:
-        """Get all loaded wallets"""
-        return list(self.wallets.values())
+        """Get all stored wallets; reads the ones not looked up yet and skips those that do not decrypt"""
+        wallets = (self.get_wallet(address) for address in list(self.wallets))
+        return [wallet for wallet in wallets if wallet is not None]
+    
+    def update_balance(self, address: str, balance: float) -> bool:
+        """Update a wallet's balance without reading or decrypting it
+        
+        A wallet not looked up yet gets the balance when it is read. Returns
+        False if the address is not stored.
+        """
+        wallet = self.wallets.loaded(address)
+        if wallet is not None:
+            wallet.update_balance(balance)
+            return True
+        if address not in self.store_addresses():
+            return False
+        self._balances[address] = float(balance)
+        return True
+    
+    def store_addresses(self):
+        """Addresses in the wallet store, without reading the wallets"""
+        return self.store.index.keys() if self.store is not None else {}.keys()
+    
+    def close(self) -> None:
+        """Write the store index and close the file"""
+        if self.store is not None:
+            self.store.close()
+            self.store = None
     
     def delete_wallet(self, address: str) -> bool:
         """Delete wallet from storage"""
         try:
             if address in self.wallets:
                 del self.wallets[address]
+            self._balances.pop(address, None)
                 
+            deleted = self.store is not None and self.store.delete(address)
+            
+            # File of an older SDK version that was not imported
             filename = f"{address}.json"
             wallet_path = os.path.join(self.storage_dir, filename)
             
             if os.path.exists(wallet_path):
                 os.remove(wallet_path)
                 return True
-            return False
+            return deleted
                 
         except Exception as e:
             logger.error(f"Error deleting wallet {address}: {e}")
             return False
     
-    def _encrypt_wallet_data(self, wallet_data: Dict[str, Any], password: str) -> Dict[str, Any]:
-        """Encrypt wallet data with password"""
-        # Simple encryption for demonstration
-        # In production, use a proper encryption library
+    def _open_store(self) -> WalletStore:
+        if self.store is None:
+            self.store = WalletStore(os.path.join(self.storage_dir, self.STORE_FILENAME))
+        return self.store
+    
+    def _save_wallet(self, wallet: InterverseWallet, key: Optional[bytes]) -> bool:
+        """Write a wallet record, its private key encrypted with ``key`` if there is one"""
+        try:
+            record = wallet.to_dict(include_private=True)
+            
+            # Encrypt if a key was derived
+            private_key = record.pop("private_key", None)
+            if private_key and key:
+                record["private"] = self._encrypt_wallet_data({"private_key": private_key}, key)
+            elif private_key:
+                record["private_key"] = private_key
+                
+            self._open_store().write(record)
+                
+            # Add to memory cache
+            self.wallets[wallet.address] = wallet
+            self._balances.pop(wallet.address, None)
+            return True
+                
+        except Exception as e:
+            logger.error(f"Error saving wallet {wallet.address}: {e}")
+            return False
+    
+    def _store_salt(self) -> bytes:
+        """Random salt of the wallet store, created the first time a key is derived"""
+        if self._salt is None:
+            salt_path = os.path.join(self.storage_dir, self.SALT_FILENAME)
+            if os.path.exists(salt_path):
+                with open(salt_path, 'rb') as f:
+                    self._salt = f.read()
+            else:
+                salt = os.urandom(16)
+                with open(salt_path, 'wb') as f:
+                    f.write(salt)
+                    f.flush()
+                    os.fsync(f.fileno())
+                self._salt = salt
+        return self._salt
+    
+    def _read_wallet(self, address: str) -> InterverseWallet:
+        """Build a wallet from its stored record
         
-        # Generate key from password
-        key = hashlib.pbkdf2_hmac(
+        KeyError if there is none, WalletDecryptionError if its private key
+        does not decrypt with the loaded key.
+        """
+        record = self.store.read(address) if self.store is not None else None
+        if record is None:
+            raise KeyError(address)
+            
+        encrypted = record.pop("private", None)
+        if encrypted and self._key:
+            try:
+                record["private_key"] = self._decrypt_wallet_data(encrypted, self._key).get("private_key", "")
+            except Exception as e:
+                raise WalletDecryptionError(f"Error decrypting wallet {address}: {e}") from e
+        elif encrypted:
+            logger.warning(f"Wallet {address} is encrypted and was loaded without a password")
+            
+        wallet = InterverseWallet.from_dict(record)
+        balance = self._balances.pop(address, None)
+        if balance is not None:
+            wallet.update_balance(balance)
+        return wallet
+    
+    def _import_wallet_files(self, password: Optional[str]) -> None:
+        """Move the per-wallet JSON files of older SDK versions into the store"""
+        try:
+            filenames = [filename for filename in os.listdir(self.storage_dir) if filename.endswith('.json')]
+        except OSError as e:
+            logger.error(f"Error listing wallet files: {e}")
+            return
+            
+        legacy_key = None
+        for filename in filenames:
+            wallet_path = os.path.join(self.storage_dir, filename)
+            try:
+                with open(wallet_path, 'r') as f:
+                    wallet_data = json.load(f)
+                    
+                # Encrypted files only reveal their address with the password
+                encrypted = wallet_data.get("encrypted", False)
+                if encrypted and not password:
+                    logger.warning(f"Cannot import encrypted wallet file {filename} without a password")
+                    continue
+                if encrypted:
+                    # Derived once for all files, they share the fixed salt
+                    legacy_key = legacy_key or self._derive_key(password, self.LEGACY_SALT)
+                    wallet_data = self._decrypt_wallet_data(wallet_data, legacy_key)
+                    
+                wallet = InterverseWallet.from_dict(wallet_data)
+                if wallet.address and self._save_wallet(wallet, self._key if encrypted else None):
+                    os.remove(wallet_path)
+                    logger.info(f"Imported wallet file {filename} into the wallet store")
+                    
+            except Exception as e:
+                logger.error(f"Error loading wallet {filename}: {e}")
+    
+    @staticmethod
+    def _derive_key(password: str, salt: bytes) -> bytes:
+        """PBKDF2 key of a password"""
+        return hashlib.pbkdf2_hmac(
             'sha256', 
             password.encode('utf-8'), 
-            b'interverse-salt', 
+            salt, 
             100000
         )
+    
+    def _encrypt_wallet_data(self, wallet_data: Dict[str, Any], key: bytes) -> Dict[str, Any]:
+        """Encrypt wallet data with a derived key"""
+        # Simple encryption for demonstration
+        # In production, use a proper encryption library
         
         # Convert wallet data to string
         data_str = json.dumps(wallet_data)
@@ -216,16 +396,8 @@ class WalletStorage:
             "data": base64.b64encode(encrypted_bytes).decode('utf-8')
         }
     
-    def _decrypt_wallet_data(self, encrypted_data: Dict[str, Any], password: str) -> Dict[str, Any]:
-        """Decrypt wallet data with password"""
-        # Generate key from password
-        key = hashlib.pbkdf2_hmac(
-            'sha256', 
-            password.encode('utf-8'), 
-            b'interverse-salt', 
-            100000
-        )
-        
+    def _decrypt_wallet_data(self, encrypted_data: Dict[str, Any], key: bytes) -> Dict[str, Any]:
+        """Decrypt wallet data with a derived key"""
         # Decode encrypted data
         encrypted_bytes = base64.b64decode(encrypted_data.get("data", ""))
         
@@ -318,22 +490,30 @@ class WalletManager:
             return True
         return False
     
-    async def update_balances(self) -> Dict[str, float]:
-        """Update balances for all wallets"""
-        updated_balances = {}
+    async def update_balances(self, max_concurrency: int = 4) -> Dict[str, float]:
+        """Update balances for all wallets
         
-        for address, wallet in self.storage.wallets.items():
-            try:
-                balance_result = await self.chain.get_balance(address)
-                
-                if balance_result.get("success", False):
-                    new_balance = balance_result.get("balance", wallet.balance)
-                    wallet.update_balance(new_balance)
-                    updated_balances[address] = new_balance
-                    
-            except Exception as e:
-                logger.error(f"Error updating balance for {address}: {e}")
+        Uses one bulk request per chunk of addresses with at most
+        ``max_concurrency`` in flight (see InterverseChain.get_balances).
+        """
+        if not self.storage.wallets:
+            return {}
+            
+        try:
+            result = await self.chain.get_balances(list(self.storage.wallets), max_concurrency=max_concurrency)
+        except Exception as e:
+            logger.error(f"Error updating balances: {e}")
+            return {}
+            
+        # Wallets not looked up yet stay encrypted; they are given the balance when read
+        updated_balances = {}
+        for address, balance in result.get("balances", {}).items():
+            if self.storage.update_balance(address, balance):
+                updated_balances[address] = balance
                 
+        for address, error in result.get("errors", {}).items():
+            logger.error(f"Error updating balance for {address}: {error}")
+            
         return updated_balances
     
     async def update_transactions(self, address: Optional[str] = None) -> int:
@@ -360,14 +540,20 @@ class WalletManager:
             if not tx_result.get("success", False):
                 return 0
                 
-            transactions = tx_result.get("transactions", [])
-            
-            # Clear existing transactions and add new ones
-            wallet.transactions = []
-            for tx in transactions:
+            # The log only ever grows, so add what the wallet does not hold yet;
+            # entries logged from events give way to the node's record
+            known = {transaction_key(tx): index for index, tx in enumerate(wallet.transactions)}
+            added = []
+            for tx in tx_result.get("transactions", []):
+                index = known.get(transaction_key(tx))
+                if index is None:
+                    added.append(tx)
+                elif wallet.transactions[index].get("local") and not tx.get("local"):
+                    wallet.transactions[index] = tx
+            for tx in added:
                 wallet.add_transaction(tx)
                 
-            return len(transactions)
+            return len(added)
             
         except Exception as e:
             logger.error(f"Error updating transactions for {wallet.address}: {e}")
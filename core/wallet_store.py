@@ -0,0 +1,215 @@
+import json
+import mmap
+import os
+import struct
+import logging
+from typing import Dict, Any, Optional, Tuple, Iterator
+
+logger = logging.getLogger("interverse.wallet_store")
+
+MAGIC = b"IVWS"
+VERSION = 1
+
+# magic, version, offset of the latest index block (0 for none)
+_HEADER = struct.Struct("<4sB3xQ")
+_INDEX_OFFSET_AT = 8
+# payload length, record kind
+_FRAME = struct.Struct("<IB")
+
+RECORD_WALLET = 1  # JSON wallet record with an "address"
+RECORD_DELETE = 2  # UTF-8 address
+RECORD_INDEX = 3   # JSON {address: [payload offset, payload length]} of every live wallet
+
+# Records appended after the last index block before a new one is written
+INDEX_AFTER_RECORDS = 256
+# Rewrite the file once superseded records take more space than live ones, if it is at least this big
+COMPACT_MIN_BYTES = 1024 * 1024
+
+
+class WalletStore:
+    """Single-file wallet store with an address -> offset index
+
+    Wallet records are appended to the file; every ``INDEX_AFTER_RECORDS``
+    records an index block of all live wallets follows and the header is
+    pointed at it. Opening the store reads that index and the few records
+    after it, no other wallet. Records are read through a read-only mmap on
+    demand. A torn record at the end (crash while writing) is cut off when
+    the store is opened.
+    """
+
+    def __init__(self, path: str):
+        self.path = path
+        self.index: Dict[str, Tuple[int, int]] = {}
+        self._file = None
+        self._map: Optional[mmap.mmap] = None
+        self._records_since_index = 0
+        self._open()
+
+    def __contains__(self, address: str) -> bool:
+        return address in self.index
+
+    def __len__(self) -> int:
+        return len(self.index)
+
+    def __iter__(self) -> Iterator[str]:
+        return iter(self.index)
+
+    def read(self, address: str) -> Optional[Dict[str, Any]]:
+        """The stored record of a wallet, or None"""
+        entry = self.index.get(address)
+        if entry is None:
+            return None
+        start, length = entry
+        return json.loads(self._view()[start:start + length])
+
+    def write(self, record: Dict[str, Any]) -> None:
+        """Store a wallet record, replacing the previous one of its address"""
+        payload = json.dumps(record, separators=(",", ":")).encode("utf-8")
+        self.index[record["address"]] = (self._append(RECORD_WALLET, payload), len(payload))
+        self._maybe_write_index()
+
+    def delete(self, address: str) -> bool:
+        """Remove a wallet, returns False if it was not stored"""
+        if address not in self.index:
+            return False
+        self._append(RECORD_DELETE, address.encode("utf-8"))
+        del self.index[address]
+        self._maybe_write_index()
+        return True
+
+    def close(self) -> None:
+        """Write a final index so the next open reads no records, then close the file"""
+        if self._file is None:
+            return
+        if self._records_since_index:
+            self.write_index()
+        self._close_map()
+        self._file.close()
+        self._file = None
+
+    def write_index(self) -> None:
+        """Append an index block of the live wallets, compacting the file first if it is mostly garbage"""
+        live_bytes = sum(length + _FRAME.size for _, length in self.index.values())
+        size = os.fstat(self._file.fileno()).st_size
+        if size >= COMPACT_MIN_BYTES and size - live_bytes > live_bytes:
+            self._compact()
+            return
+
+        offset = self._append(RECORD_INDEX, self._index_payload()) - _FRAME.size
+        self._file.seek(_INDEX_OFFSET_AT)
+        self._file.write(struct.pack("<Q", offset))
+        self._sync()
+        self._records_since_index = 0
+
+    def _open(self) -> None:
+        directory = os.path.dirname(self.path)
+        if directory:
+            os.makedirs(directory, exist_ok=True)
+
+        if not os.path.exists(self.path) or os.path.getsize(self.path) < _HEADER.size:
+            self._file = open(self.path, "w+b")
+            self._file.write(_HEADER.pack(MAGIC, VERSION, 0))
+            self._sync()
+            return
+
+        self._file = open(self.path, "r+b")
+        magic, version, index_offset = _HEADER.unpack(self._file.read(_HEADER.size))
+        if magic != MAGIC or version != VERSION:
+            self._file.close()
+            self._file = None
+            raise ValueError(f"{self.path} is not a version {VERSION} wallet store")
+
+        view = self._view()
+        end = self._scan(view, index_offset or _HEADER.size)
+        if end < len(view):
+            logger.warning(f"Dropping {len(view) - end} bytes of a torn record at the end of {self.path}")
+            self._close_map()
+            self._file.truncate(end)
+            self._sync()
+
+    def _scan(self, view: mmap.mmap, position: int) -> int:
+        """Apply the records from position on to the index, returns where the last complete one ends"""
+        while position + _FRAME.size <= len(view):
+            length, kind = _FRAME.unpack_from(view, position)
+            start = position + _FRAME.size
+            if start + length > len(view):
+                break
+
+            try:
+                payload = view[start:start + length]
+                if kind == RECORD_WALLET:
+                    self.index[json.loads(payload)["address"]] = (start, length)
+                elif kind == RECORD_DELETE:
+                    self.index.pop(payload.decode("utf-8"), None)
+                elif kind == RECORD_INDEX:
+                    # Also covers an index block whose header update was lost in a crash
+                    self.index = {address: (entry[0], entry[1]) for address, entry in json.loads(payload).items()}
+                    self._records_since_index = -1
+            except (ValueError, KeyError, UnicodeDecodeError):
+                break
+
+            self._records_since_index += 1
+            position = start + length
+        return position
+
+    def _append(self, kind: int, payload: bytes) -> int:
+        """Write a record at the end of the file and return the offset of its payload"""
+        self._close_map()
+        self._file.seek(0, os.SEEK_END)
+        start = self._file.tell() + _FRAME.size
+        self._file.write(_FRAME.pack(len(payload), kind))
+        self._file.write(payload)
+        self._sync()
+        self._records_since_index += 1
+        return start
+
+    def _maybe_write_index(self) -> None:
+        if self._records_since_index >= INDEX_AFTER_RECORDS:
+            self.write_index()
+
+    def _index_payload(self) -> bytes:
+        return json.dumps({address: list(entry) for address, entry in self.index.items()},
+                          separators=(",", ":")).encode("utf-8")
+
+    def _compact(self) -> None:
+        # Replace atomically so a crash never leaves a half-written store
+        view = self._view()
+        temp_path = self.path + ".tmp"
+        index: Dict[str, Tuple[int, int]] = {}
+        with open(temp_path, "wb") as f:
+            f.write(_HEADER.pack(MAGIC, VERSION, 0))
+            for address, (start, length) in self.index.items():
+                f.write(_FRAME.pack(length, RECORD_WALLET))
+                index[address] = (f.tell(), length)
+                f.write(view[start:start + length])
+
+            self.index = index
+            payload = self._index_payload()
+            index_offset = f.tell()
+            f.write(_FRAME.pack(len(payload), RECORD_INDEX))
+            f.write(payload)
+            f.seek(_INDEX_OFFSET_AT)
+            f.write(struct.pack("<Q", index_offset))
+            f.flush()
+            os.fsync(f.fileno())
+
+        self._close_map()
+        self._file.close()
+        os.replace(temp_path, self.path)
+        self._file = open(self.path, "r+b")
+        self._records_since_index = 0
+
+    def _view(self) -> mmap.mmap:
+        if self._map is None:
+            self._map = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+        return self._map
+
+    def _close_map(self) -> None:
+        # Appending, truncating or replacing a mapped file fails on Windows
+        if self._map is not None:
+            self._map.close()
+            self._map = None
+
+    def _sync(self) -> None:
+        self._file.flush()
+        os.fsync(self._file.fileno())
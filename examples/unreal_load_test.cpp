@@ -0,0 +1,99 @@
+// Example of load testing the Interverse SDK in Unreal Engine against benchmarks/mock_node.py
+//
+// Place the actor in an empty level with NodeUrl pointing at the mock node, run with
+// "stat Interverse" (or -trace=cpu,counters,Interverse for Insights) and read the summary
+// logged after DurationSeconds.
+
+void AInterverseLoadTestActor::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // 1. One component per simulated client. bUseSharedConnection puts them all on one WebSocket.
+    for (int32 Index = 0; Index < NumClients; ++Index)
+    {
+        UInterverseSDKComponent* Client = NewObject<UInterverseSDKComponent>(this);
+        Client->NodeUrl = TEXT("http://127.0.0.1:8765");
+        Client->GameId = TEXT("benchmark");
+        Client->ApiKey = TEXT("benchmark");
+        Client->bUseSharedConnection = true;
+        Client->RegisterComponent();
+        Clients.Add(Client);
+    }
+
+    // 2. Create the wallets, each client subscribes to its own
+    for (int32 Index = 0; Index < NumWallets; ++Index)
+    {
+        UInterverseSDKComponent* Client = Clients[Index % Clients.Num()];
+        Client->CreateWalletAsync().Next([this, Client](const FInterverseWalletResult& Result)
+        {
+            if (Result.bSuccess)
+            {
+                Wallets.Add({ Client, Result.Wallet.Address });
+                Client->SubscribeAddresses({ Result.Wallet.Address });
+            }
+        });
+    }
+
+    EndTime = FPlatformTime::Seconds() + DurationSeconds;
+}
+
+void AInterverseLoadTestActor::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    // 3. Keep CallsPerTick operations in flight: mint, transfer an owned asset or read the balance
+    if (FPlatformTime::Seconds() < EndTime)
+    {
+        for (int32 Call = 0; Call < CallsPerTick && Wallets.Num() > 1; ++Call)
+        {
+            const int32 WalletIndex = FMath::RandRange(0, Wallets.Num() - 1);
+            FLoadTestWallet& Wallet = Wallets[WalletIndex];
+            const FLoadTestWallet& Peer = Wallets[FMath::RandRange(0, Wallets.Num() - 1)];
+            const float Roll = FMath::FRand();
+
+            if (Roll < 0.4f || Wallet.OwnedAssets.Num() == 0)
+            {
+                FInterverseBaseProperties Properties;
+                Properties.Level = FMath::RandRange(1, 50);
+                Wallet.Client->MintGameAssetAsync(Wallet.Address, Properties, {}).Next(
+                    [this, WalletIndex](const FInterverseMintResult& Result)
+                    {
+                        if (Result.bSuccess)
+                        {
+                            Wallets[WalletIndex].OwnedAssets.Add(Result.Asset.AssetId);
+                        }
+                    });
+            }
+            else if (Roll < 0.8f && Peer.Client == Wallet.Client && Peer.Address != Wallet.Address)
+            {
+                Wallet.Client->TransferAsset(Wallet.OwnedAssets.Pop(), Wallet.Address, Peer.Address);
+            }
+            else
+            {
+                Wallet.Client->GetBalance(Wallet.Address);
+            }
+        }
+        return;
+    }
+
+    // 4. Report once. Game-thread cost per frame is "Drain Socket Events" in stat Interverse.
+    if (!bReported)
+    {
+        bReported = true;
+        for (const UInterverseSDKComponent* Client : Clients)
+        {
+            const FInterverseSDKStats Stats = Client->GetStats();
+            for (const FInterverseOperationStats& Operation : Stats.Operations)
+            {
+                UE_LOG(LogInterverse, Display, TEXT("%s: %d calls, %d failed, p50 %.1f ms, p95 %.1f ms, p99 %.1f ms"),
+                    *UEnum::GetDisplayValueAsText(Operation.Operation).ToString(), Operation.Count,
+                    Operation.Failures, Operation.P50Ms, Operation.P95Ms, Operation.P99Ms);
+            }
+            UE_LOG(LogInterverse, Display, TEXT("HTTP %lld bytes sent, %lld received; %lld socket messages, %d dropped"),
+                Stats.Requests.BytesSent, Stats.Requests.BytesReceived, Stats.Socket.MessagesReceived,
+                Stats.DroppedSocketEvents);
+        }
+        UE_LOG(LogInterverse, Display, TEXT("Memory used: %.1f MB"),
+            FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+    }
+}
@@ -0,0 +1,383 @@
+#include "InterverseAssetCache.h"
+#include "InterverseBinaryCodec.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+bool FInterverseAssetCache::IsWarm(const FString& Address) const
+{
+    const FPlayerAssets* Player = Players.Find(Address);
+    return Player && Player->bComplete;
+}
+
+bool FInterverseAssetCache::GetAssets(const FString& Address, TArray<FInterverseAsset>& OutAssets) const
+{
+    const FPlayerAssets* Player = Players.Find(Address);
+    if (!Player || !Player->bComplete)
+    {
+        return false;
+    }
+
+    OutAssets.Reset(Player->Assets.Num());
+    for (const TPair<FString, FInterverseCompactAsset>& Pair : Player->Assets)
+    {
+        Pair.Value.ToAsset(OutAssets.AddDefaulted_GetRef());
+    }
+    return true;
+}
+
+bool FInterverseAssetCache::QueryAssets(const FString& Address, const FInterverseAssetQuery& Query,
+                                        TArray<FInterverseAsset>& OutAssets) const
+{
+    const FPlayerAssets* Player = Players.Find(Address);
+    if (!Player || !Player->bComplete)
+    {
+        return false;
+    }
+
+    TArray<FString> AssetIds;
+    Player->Index.Query(Query, AssetIds);
+
+    OutAssets.Reset(AssetIds.Num());
+    for (const FString& AssetId : AssetIds)
+    {
+        Player->Assets.FindChecked(AssetId).ToAsset(OutAssets.AddDefaulted_GetRef());
+    }
+    return true;
+}
+
+bool FInterverseAssetCache::FindAsset(const FString& AssetId, FInterverseAsset& OutAsset) const
+{
+    const FString* Owner = OwnerByAssetId.Find(AssetId);
+    const FPlayerAssets* Player = Owner ? Players.Find(*Owner) : nullptr;
+    const FInterverseCompactAsset* Asset = Player ? Player->Assets.Find(AssetId) : nullptr;
+    if (!Asset)
+    {
+        return false;
+    }
+    Asset->ToAsset(OutAsset);
+    return true;
+}
+
+void FInterverseAssetCache::ReplaceAll(const FString& Address, TArray<FInterverseAsset>&& Assets, const FDateTime& SyncTime)
+{
+    if (FPlayerAssets* Existing = Players.Find(Address))
+    {
+        for (const TPair<FString, FInterverseCompactAsset>& Pair : Existing->Assets)
+        {
+            OwnerByAssetId.Remove(Pair.Key);
+        }
+    }
+
+    FPlayerAssets& Player = Players.Add(Address);
+    Player.Assets.Reserve(Assets.Num());
+    Player.Index.Reserve(Assets.Num());
+    for (const FInterverseAsset& Asset : Assets)
+    {
+        Player.Index.Add(Asset);
+        OwnerByAssetId.Add(Asset.AssetId, Address);
+        Player.Assets.Add(Asset.AssetId, FInterverseCompactAsset::FromAsset(Asset));
+    }
+    Assets.Reset();
+    Player.SyncedUpTo = SyncTime;
+    Player.bComplete = true;
+}
+
+bool FInterverseAssetCache::MergeDelta(const FString& Address, const TArray<FInterverseAsset>& Changed,
+                                       const TArray<FString>& RemovedAssetIds, const FDateTime& SyncTime)
+{
+    FPlayerAssets& Player = Players.FindOrAdd(Address);
+
+    for (const FInterverseAsset& Asset : Changed)
+    {
+        // The asset may have been cached under its previous owner
+        const FString* PreviousOwner = OwnerByAssetId.Find(Asset.AssetId);
+        if (PreviousOwner && *PreviousOwner != Address)
+        {
+            if (FPlayerAssets* Previous = Players.Find(*PreviousOwner))
+            {
+                Previous->Assets.Remove(Asset.AssetId);
+                Previous->Index.Remove(Asset.AssetId);
+            }
+        }
+
+        Player.Assets.Add(Asset.AssetId, FInterverseCompactAsset::FromAsset(Asset));
+        Player.Index.Add(Asset);
+        OwnerByAssetId.Add(Asset.AssetId, Address);
+    }
+
+    int32 RemovedCount = 0;
+    for (const FString& AssetId : RemovedAssetIds)
+    {
+        if (Player.Assets.Remove(AssetId) > 0)
+        {
+            Player.Index.Remove(AssetId);
+            OwnerByAssetId.Remove(AssetId);
+            ++RemovedCount;
+        }
+    }
+
+    if (SyncTime > Player.SyncedUpTo)
+    {
+        Player.SyncedUpTo = SyncTime;
+    }
+
+    return Changed.Num() > 0 || RemovedCount > 0;
+}
+
+void FInterverseAssetCache::MarkComplete(const FString& Address, const FDateTime& SyncTime)
+{
+    FPlayerAssets& Player = Players.FindOrAdd(Address);
+    Player.SyncedUpTo = SyncTime;
+    Player.bComplete = true;
+}
+
+void FInterverseAssetCache::ApplyAsset(const FInterverseAsset& Asset)
+{
+    if (Asset.AssetId.IsEmpty() || Asset.Owner.IsEmpty())
+    {
+        return;
+    }
+
+    const FString* PreviousOwner = OwnerByAssetId.Find(Asset.AssetId);
+    if (PreviousOwner && *PreviousOwner != Asset.Owner)
+    {
+        if (FPlayerAssets* Previous = Players.Find(*PreviousOwner))
+        {
+            Previous->Assets.Remove(Asset.AssetId);
+            Previous->Index.Remove(Asset.AssetId);
+        }
+        OwnerByAssetId.Remove(Asset.AssetId);
+    }
+
+    // Only track owners we already hold a list for; others are fetched on demand
+    if (FPlayerAssets* Player = Players.Find(Asset.Owner))
+    {
+        Player->Assets.Add(Asset.AssetId, FInterverseCompactAsset::FromAsset(Asset));
+        Player->Index.Add(Asset);
+        OwnerByAssetId.Add(Asset.AssetId, Asset.Owner);
+    }
+}
+
+void FInterverseAssetCache::MoveAsset(const FString& AssetId, const FString& FromAddress, const FString& ToAddress)
+{
+    FPlayerAssets* From = Players.Find(FromAddress);
+    FInterverseCompactAsset Asset;
+    if (!From || !From->Assets.RemoveAndCopyValue(AssetId, Asset))
+    {
+        return;
+    }
+    From->Index.Remove(AssetId);
+    OwnerByAssetId.Remove(AssetId);
+
+    if (FPlayerAssets* To = Players.Find(ToAddress))
+    {
+        Asset.Owner = ToAddress;
+        Asset.ModifiedAt = FDateTime::UtcNow();
+        To->Index.Add(Asset);
+        To->Assets.Add(AssetId, MoveTemp(Asset));
+        OwnerByAssetId.Add(AssetId, ToAddress);
+    }
+}
+
+void FInterverseAssetCache::BeginPendingTransfer(const FString& AssetId, const FString& FromAddress, const FString& ToAddress)
+{
+    FPendingHop& Hop = PendingTransfers.FindOrAdd(AssetId).AddDefaulted_GetRef();
+    Hop.FromAddress = FromAddress;
+    Hop.ToAddress = ToAddress;
+    if (const FInterverseCompactAsset* Asset = FindMutable(FromAddress, AssetId))
+    {
+        Hop.Original = *Asset;
+    }
+
+    MoveAsset(AssetId, FromAddress, ToAddress);
+    if (FInterverseCompactAsset* Moved = FindMutable(ToAddress, AssetId))
+    {
+        Moved->bPendingTransfer = true;
+    }
+}
+
+int32 FInterverseAssetCache::FindUnsettledHop(const TArray<FPendingHop>& Hops, const FString& FromAddress, const FString& ToAddress)
+{
+    return Hops.IndexOfByPredicate([&FromAddress, &ToAddress](const FPendingHop& Hop)
+    {
+        return !Hop.bConfirmed && Hop.FromAddress == FromAddress && Hop.ToAddress == ToAddress;
+    });
+}
+
+bool FInterverseAssetCache::ConfirmTransfer(const FString& AssetId, const FString& FromAddress, const FString& ToAddress)
+{
+    TArray<FPendingHop>* Hops = PendingTransfers.Find(AssetId);
+    if (!Hops)
+    {
+        return false;
+    }
+    const int32 HopIndex = FindUnsettledHop(*Hops, FromAddress, ToAddress);
+    if (HopIndex == INDEX_NONE)
+    {
+        // The other settle path got here first, or the hop is confirmed behind one still in flight
+        return Hops->ContainsByPredicate([&FromAddress, &ToAddress](const FPendingHop& Hop)
+        {
+            return Hop.FromAddress == FromAddress && Hop.ToAddress == ToAddress;
+        });
+    }
+    (*Hops)[HopIndex].bConfirmed = true;
+
+    // Hops confirmed in order can no longer be rolled back, so their records are not needed anymore
+    int32 NumConfirmed = 0;
+    while (NumConfirmed < Hops->Num() && (*Hops)[NumConfirmed].bConfirmed)
+    {
+        ++NumConfirmed;
+    }
+    if (NumConfirmed < Hops->Num())
+    {
+        Hops->RemoveAt(0, NumConfirmed);
+        return true;
+    }
+
+    // A full fetch of an earlier owner may have brought the record back in the meantime
+    const FString FinalOwner = Hops->Last().ToAddress;
+    const FString CurrentOwner = OwnerByAssetId.FindRef(AssetId);
+    if (!CurrentOwner.IsEmpty() && CurrentOwner != FinalOwner)
+    {
+        MoveAsset(AssetId, CurrentOwner, FinalOwner);
+    }
+    if (FInterverseCompactAsset* Asset = FindMutable(FinalOwner, AssetId))
+    {
+        Asset->bPendingTransfer = false;
+    }
+    PendingTransfers.Remove(AssetId);
+    return true;
+}
+
+bool FInterverseAssetCache::RollbackTransfer(const FString& AssetId, const FString& FromAddress, const FString& ToAddress,
+                                             FString& OutPendingAddress)
+{
+    TArray<FPendingHop>* Hops = PendingTransfers.Find(AssetId);
+    const int32 HopIndex = Hops ? FindUnsettledHop(*Hops, FromAddress, ToAddress) : INDEX_NONE;
+    if (HopIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutPendingAddress = Hops->Last().ToAddress;
+    TOptional<FInterverseCompactAsset> Original = MoveTemp((*Hops)[HopIndex].Original);
+    Hops->RemoveAt(HopIndex, Hops->Num() - HopIndex);
+    const bool bStillPending = Hops->Num() > 0;
+    if (!bStillPending)
+    {
+        PendingTransfers.Remove(AssetId);
+    }
+
+    RemoveFromOwner(AssetId);
+    if (Original.IsSet())
+    {
+        // The record was taken mid-chain if an earlier hop is still in flight
+        Original->bPendingTransfer = bStillPending;
+        Store(FromAddress, MoveTemp(Original.GetValue()));
+    }
+    return true;
+}
+
+FInterverseCompactAsset* FInterverseAssetCache::FindMutable(const FString& Address, const FString& AssetId)
+{
+    FPlayerAssets* Player = Players.Find(Address);
+    return Player ? Player->Assets.Find(AssetId) : nullptr;
+}
+
+void FInterverseAssetCache::Store(const FString& Address, FInterverseCompactAsset&& Asset)
+{
+    if (FPlayerAssets* Player = Players.Find(Address))
+    {
+        Player->Index.Add(Asset);
+        OwnerByAssetId.Add(Asset.AssetId, Address);
+        FString AssetId = Asset.AssetId;
+        Player->Assets.Add(MoveTemp(AssetId), MoveTemp(Asset));
+    }
+}
+
+void FInterverseAssetCache::RemoveFromOwner(const FString& AssetId)
+{
+    FString Owner;
+    if (OwnerByAssetId.RemoveAndCopyValue(AssetId, Owner))
+    {
+        if (FPlayerAssets* Player = Players.Find(Owner))
+        {
+            Player->Assets.Remove(AssetId);
+            Player->Index.Remove(AssetId);
+        }
+    }
+}
+
+void FInterverseAssetCache::Invalidate(const FString& Address)
+{
+    FPlayerAssets Removed;
+    if (Players.RemoveAndCopyValue(Address, Removed))
+    {
+        for (const TPair<FString, FInterverseCompactAsset>& Pair : Removed.Assets)
+        {
+            OwnerByAssetId.Remove(Pair.Key);
+        }
+    }
+}
+
+bool FInterverseAssetCache::LoadFromDisk(const FString& Address)
+{
+    if (PersistDirectory.IsEmpty())
+    {
+        return false;
+    }
+
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *GetCacheFilePath(Address), FILEREAD_Silent))
+    {
+        return false;
+    }
+
+    // Read as views so each record goes into its compact form without a TMap in between
+    TArray<FInterverseCompactAsset> Assets;
+    FDateTime SyncedUpTo;
+    const bool bDecoded = FInterverseBinaryCodec::ReadAssetList(Bytes, SyncedUpTo, [&Assets](const FInterverseAssetView& View)
+    {
+        Assets.Add(FInterverseCompactAsset::FromView(View));
+    });
+    if (!bDecoded)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Discarding corrupt or outdated asset cache for %s"), *Address);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Loaded %d cached assets for %s"), Assets.Num(), *Address);
+    Invalidate(Address);
+    Players.Add(Address).Assets.Reserve(Assets.Num());
+    for (FInterverseCompactAsset& Asset : Assets)
+    {
+        Store(Address, MoveTemp(Asset));
+    }
+    MarkComplete(Address, SyncedUpTo);
+    return true;
+}
+
+void FInterverseAssetCache::SaveToDisk(const FString& Address) const
+{
+    const FPlayerAssets* Player = Players.Find(Address);
+    if (PersistDirectory.IsEmpty() || !Player || !Player->bComplete)
+    {
+        return;
+    }
+
+    TArray<FInterverseAsset> Assets;
+    GetAssets(Address, Assets);
+
+    TArray<uint8> Bytes;
+    FInterverseBinaryCodec::EncodeAssetList(Assets, Player->SyncedUpTo, Bytes);
+
+    if (!FFileHelper::SaveArrayToFile(Bytes, *GetCacheFilePath(Address)))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write asset cache for %s"), *Address);
+    }
+}
+
+FString FInterverseAssetCache::GetCacheFilePath(const FString& Address) const
+{
+    return FPaths::Combine(PersistDirectory, FPaths::MakeValidFileName(Address) + TEXT(".ivc"));
+}
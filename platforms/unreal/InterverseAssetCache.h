@@ -0,0 +1,104 @@
+// platforms/unreal/InterverseAssetCache.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InterverseTypes.h"
+#include "InterverseAssetIndex.h"
+#include "InterversePropertyBag.h"
+
+// Per-address asset records kept current by WebSocket events and ModifiedAt-based delta fetches.
+// Records are stored compact (see FInterverseCompactAsset) and handed out as FInterverseAsset.
+class INTERVERSESDK_API FInterverseAssetCache
+{
+public:
+    struct FPlayerAssets
+    {
+        TMap<FString, FInterverseCompactAsset> Assets;
+
+        // Column-wise copy of the filterable fields of Assets
+        FInterverseAssetIndex Index;
+
+        // Node time of the last successful sync, sent as modified_since on the next fetch; unset fetches the full list
+        FDateTime SyncedUpTo;
+
+        // Only set once a full list has been downloaded (or loaded from disk)
+        bool bComplete = false;
+    };
+
+    // Empty directory disables the on-disk cache
+    void SetPersistDirectory(const FString& InDirectory) { PersistDirectory = InDirectory; }
+
+    const FPlayerAssets* Find(const FString& Address) const { return Players.Find(Address); }
+    bool IsWarm(const FString& Address) const;
+    bool GetAssets(const FString& Address, TArray<FInterverseAsset>& OutAssets) const;
+
+    // Assets of a complete address matching Query; false if the address is not cached
+    bool QueryAssets(const FString& Address, const FInterverseAssetQuery& Query, TArray<FInterverseAsset>& OutAssets) const;
+
+    // Cached record of an asset under its current owner; false if it is not cached
+    bool FindAsset(const FString& AssetId, FInterverseAsset& OutAsset) const;
+
+    // Full list from a cold fetch; replaces all records of the address. Empties Assets.
+    void ReplaceAll(const FString& Address, TArray<FInterverseAsset>&& Assets, const FDateTime& SyncTime);
+
+    // Delta fetch result; returns true if anything changed
+    bool MergeDelta(const FString& Address, const TArray<FInterverseAsset>& Changed,
+                    const TArray<FString>& RemovedAssetIds, const FDateTime& SyncTime);
+
+    // Ends a paged cold fetch whose pages were merged with MergeDelta
+    void MarkComplete(const FString& Address, const FDateTime& SyncTime);
+
+    // Incremental event from the WebSocket; moves the asset if its owner changed
+    void ApplyAsset(const FInterverseAsset& Asset);
+    void MoveAsset(const FString& AssetId, const FString& FromAddress, const FString& ToAddress);
+
+    // Optimistic transfer: moves the asset right away, tagged bPendingTransfer, and keeps the record it had
+    // before until the node answers. A transfer of an asset that is already pending is chained on as a new hop.
+    void BeginPendingTransfer(const FString& AssetId, const FString& FromAddress, const FString& ToAddress);
+    bool IsTransferPending(const FString& AssetId) const { return PendingTransfers.Contains(AssetId); }
+
+    // Node confirmed the oldest unsettled FromAddress -> ToAddress hop of the asset; the tag is cleared once
+    // every hop is confirmed. Returns false if no such hop was ever pending or it was already dropped.
+    bool ConfirmTransfer(const FString& AssetId, const FString& FromAddress, const FString& ToAddress);
+
+    // Node rejected the oldest unsettled FromAddress -> ToAddress hop: puts back the record the asset had
+    // before that hop and forgets the hops chained after it. Hops before it stay pending. OutPendingAddress
+    // is the owner the asset was shown under. Returns false if the hop was not pending or already settled.
+    bool RollbackTransfer(const FString& AssetId, const FString& FromAddress, const FString& ToAddress,
+                          FString& OutPendingAddress);
+
+    void Invalidate(const FString& Address);
+
+    // Attempts to warm the address from disk; returns true if a complete record was loaded
+    bool LoadFromDisk(const FString& Address);
+    void SaveToDisk(const FString& Address) const;
+
+private:
+    // One optimistic transfer of an asset; a hop is settled at most once
+    struct FPendingHop
+    {
+        FString FromAddress;
+        FString ToAddress;
+
+        // Record under FromAddress before this hop; unset if that owner was not cached
+        TOptional<FInterverseCompactAsset> Original;
+
+        bool bConfirmed = false;
+    };
+
+    // Oldest unconfirmed hop from FromAddress to ToAddress, or INDEX_NONE
+    static int32 FindUnsettledHop(const TArray<FPendingHop>& Hops, const FString& FromAddress, const FString& ToAddress);
+
+    FString GetCacheFilePath(const FString& Address) const;
+
+    // Record of an asset under Address, or nullptr
+    FInterverseCompactAsset* FindMutable(const FString& Address, const FString& AssetId);
+    void Store(const FString& Address, FInterverseCompactAsset&& Asset);
+    void RemoveFromOwner(const FString& AssetId);
+
+    TMap<FString, FPlayerAssets> Players;
+    TMap<FString, FString> OwnerByAssetId;
+    // Hops per asset in the order they were sent; confirmed hops are dropped once all earlier ones are
+    TMap<FString, TArray<FPendingHop>> PendingTransfers;
+    FString PersistDirectory;
+};
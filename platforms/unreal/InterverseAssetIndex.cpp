@@ -0,0 +1,239 @@
+#include "InterverseAssetIndex.h"
+#include "InterversePropertyBag.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "The column scans read byte N of a word as row N");
+
+namespace
+{
+    constexpr uint64 HighBits = 0x8080808080808080ull;
+
+    constexpr uint64 Broadcast(uint8 Byte)
+    {
+        return 0x0101010101010101ull * Byte;
+    }
+
+    // High bit of every byte in Bytes that lies in [Low, High]. Bytes and bounds must be below 0x80,
+    // so the subtractions never borrow from the neighbouring byte.
+    FORCEINLINE uint64 BytesInRange(uint64 Bytes, uint64 Low, uint64 High)
+    {
+        return ((Bytes | HighBits) - Low) & ((High | HighBits) - Bytes) & HighBits;
+    }
+
+    // Moves the high bit of byte N to bit N
+    FORCEINLINE uint64 GatherHighBits(uint64 Mask)
+    {
+        return ((Mask >> 7) * 0x0102040810204080ull) >> 56;
+    }
+
+    FORCEINLINE uint64 LoadWord(const uint8* Bytes)
+    {
+        uint64 Word;
+        FMemory::Memcpy(&Word, Bytes, sizeof(Word));
+        return Word;
+    }
+}
+
+void FInterverseAssetIndex::Add(const FInterverseAsset& Asset)
+{
+    AddRow(Asset.AssetId, Asset.Category, Asset.Rarity, Asset.Metadata.Find(TEXT("tags")));
+}
+
+void FInterverseAssetIndex::Add(const FInterverseCompactAsset& Asset)
+{
+    AddRow(Asset.AssetId, Asset.Category, Asset.Rarity, Asset.FindTags());
+}
+
+void FInterverseAssetIndex::AddRow(const FString& AssetId, EInterverseItemCategory Category, EInterverseRarity Rarity,
+                                   const FString* TagList)
+{
+    int32 Row = INDEX_NONE;
+    if (const int32* Existing = RowByAssetId.Find(AssetId))
+    {
+        Row = *Existing;
+        ClearTags(Row);
+    }
+    else if (FreeRows.Num() > 0)
+    {
+        Row = FreeRows.Pop(false);
+    }
+    else
+    {
+        Row = AssetIds.AddDefaulted();
+        if (Row >= Categories.Num())
+        {
+            Categories.AddZeroed(RowsPerWord);
+            Rarities.AddZeroed(RowsPerWord);
+            LiveRows.Add(0);
+            for (TPair<FName, TArray<uint64>>& Pair : TagRows)
+            {
+                Pair.Value.Add(0);
+            }
+        }
+    }
+
+    AssetIds[Row] = AssetId;
+    RowByAssetId.Add(AssetId, Row);
+    Categories[Row] = static_cast<uint8>(Category);
+    Rarities[Row] = static_cast<uint8>(Rarity);
+
+    const uint64 Bit = 1ull << (Row % RowsPerWord);
+    const int32 Word = Row / RowsPerWord;
+    LiveRows[Word] |= Bit;
+
+    TArray<FName, TInlineAllocator<8>> Tags;
+    ParseTags(TagList, Tags);
+    for (const FName& Tag : Tags)
+    {
+        TArray<uint64>& Rows = TagRows.FindOrAdd(Tag);
+        Rows.SetNumZeroed(LiveRows.Num());
+        Rows[Word] |= Bit;
+    }
+}
+
+void FInterverseAssetIndex::Remove(const FString& AssetId)
+{
+    int32 Row = INDEX_NONE;
+    if (!RowByAssetId.RemoveAndCopyValue(AssetId, Row))
+    {
+        return;
+    }
+
+    ClearTags(Row);
+    LiveRows[Row / RowsPerWord] &= ~(1ull << (Row % RowsPerWord));
+    AssetIds[Row].Reset();
+    FreeRows.Add(Row);
+}
+
+void FInterverseAssetIndex::Reset()
+{
+    AssetIds.Reset();
+    Categories.Reset();
+    Rarities.Reset();
+    LiveRows.Reset();
+    TagRows.Reset();
+    RowByAssetId.Reset();
+    FreeRows.Reset();
+}
+
+void FInterverseAssetIndex::Reserve(int32 Number)
+{
+    const int32 PaddedRows = Align(Number, RowsPerWord);
+    AssetIds.Reserve(Number);
+    Categories.Reserve(PaddedRows);
+    Rarities.Reserve(PaddedRows);
+    LiveRows.Reserve(PaddedRows / RowsPerWord);
+    RowByAssetId.Reserve(Number);
+}
+
+void FInterverseAssetIndex::Query(const FInterverseAssetQuery& InQuery, TArray<FString>& OutAssetIds) const
+{
+    OutAssetIds.Reset();
+    ForEachMatch(InQuery, [this, &OutAssetIds](int32 Row) {
+        OutAssetIds.Add(AssetIds[Row]);
+    });
+}
+
+int32 FInterverseAssetIndex::Count(const FInterverseAssetQuery& InQuery) const
+{
+    int32 Matches = 0;
+    ForEachMatch(InQuery, [&Matches](int32) {
+        ++Matches;
+    });
+    return Matches;
+}
+
+void FInterverseAssetIndex::GetTags(const FInterverseAsset& Asset, TArray<FName, TInlineAllocator<8>>& OutTags)
+{
+    ParseTags(Asset.Metadata.Find(TEXT("tags")), OutTags);
+}
+
+void FInterverseAssetIndex::ParseTags(const FString* TagList, TArray<FName, TInlineAllocator<8>>& OutTags)
+{
+    OutTags.Reset();
+    if (!TagList)
+    {
+        return;
+    }
+
+    TArray<FString> Parts;
+    TagList->ParseIntoArray(Parts, TEXT(","));
+    for (FString& Part : Parts)
+    {
+        Part.TrimStartAndEndInline();
+        if (!Part.IsEmpty())
+        {
+            OutTags.AddUnique(FName(*Part));
+        }
+    }
+}
+
+void FInterverseAssetIndex::ForEachMatch(const FInterverseAssetQuery& InQuery, TFunctionRef<void(int32)> OnMatch) const
+{
+    // A tag no asset carries matches nothing
+    TArray<const uint64*, TInlineAllocator<8>> Tags;
+    for (const FString& Tag : InQuery.Tags)
+    {
+        const TArray<uint64>* Rows = TagRows.Find(FName(*Tag, FNAME_Find));
+        if (!Rows)
+        {
+            return;
+        }
+        Tags.Add(Rows->GetData());
+    }
+
+    const uint64 RarityLow = Broadcast(static_cast<uint8>(InQuery.MinRarity));
+    const uint64 RarityHigh = Broadcast(static_cast<uint8>(InQuery.MaxRarity));
+
+    TArray<uint64, TInlineAllocator<8>> CategoryValues;
+    for (EInterverseItemCategory Category : InQuery.Categories)
+    {
+        CategoryValues.AddUnique(Broadcast(static_cast<uint8>(Category)));
+    }
+
+    for (int32 Word = 0; Word < LiveRows.Num(); ++Word)
+    {
+        uint64 Match = LiveRows[Word];
+        for (const uint64* Rows : Tags)
+        {
+            Match &= Rows[Word];
+        }
+        if (Match == 0)
+        {
+            continue;
+        }
+
+        const int32 FirstRow = Word * RowsPerWord;
+        uint64 ColumnMatch = 0;
+        for (int32 Group = 0; Group < RowsPerWord / 8; ++Group)
+        {
+            const int32 Offset = FirstRow + Group * 8;
+            uint64 Bytes = BytesInRange(LoadWord(Rarities.GetData() + Offset), RarityLow, RarityHigh);
+            if (CategoryValues.Num() > 0)
+            {
+                const uint64 CategoryBytes = LoadWord(Categories.GetData() + Offset);
+                uint64 AnyCategory = 0;
+                for (uint64 Value : CategoryValues)
+                {
+                    AnyCategory |= BytesInRange(CategoryBytes, Value, Value);
+                }
+                Bytes &= AnyCategory;
+            }
+            ColumnMatch |= GatherHighBits(Bytes) << (Group * 8);
+        }
+
+        for (Match &= ColumnMatch; Match != 0; Match &= Match - 1)
+        {
+            OnMatch(FirstRow + static_cast<int32>(FMath::CountTrailingZeros64(Match)));
+        }
+    }
+}
+
+void FInterverseAssetIndex::ClearTags(int32 Row)
+{
+    const uint64 Mask = ~(1ull << (Row % RowsPerWord));
+    const int32 Word = Row / RowsPerWord;
+    for (TPair<FName, TArray<uint64>>& Pair : TagRows)
+    {
+        Pair.Value[Word] &= Mask;
+    }
+}
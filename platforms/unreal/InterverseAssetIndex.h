@@ -0,0 +1,55 @@
+// platforms/unreal/InterverseAssetIndex.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InterverseTypes.h"
+
+struct FInterverseCompactAsset;
+
+/**
+ * Column-wise index of one player's assets for inventory filtering.
+ *
+ * Category and rarity are packed byte arrays and every tag is a bitset over the rows, so a query
+ * tests eight assets per 64-bit word and skips 64 at a time where the tag bitsets are empty,
+ * instead of visiting every FInterverseAsset and its metadata map. Rows of removed assets are
+ * reused. Kept up to date by FInterverseAssetCache; game thread only.
+ */
+class INTERVERSESDK_API FInterverseAssetIndex
+{
+public:
+    // Adds the asset, or updates its row if it is already indexed
+    void Add(const FInterverseAsset& Asset);
+    void Add(const FInterverseCompactAsset& Asset);
+    void Remove(const FString& AssetId);
+    void Reset();
+    void Reserve(int32 Number);
+
+    int32 Num() const { return RowByAssetId.Num(); }
+
+    // Ids of the matching assets, in row order
+    void Query(const FInterverseAssetQuery& Query, TArray<FString>& OutAssetIds) const;
+    int32 Count(const FInterverseAssetQuery& Query) const;
+
+    // Tags of an asset: its "tags" metadata entry split at commas
+    static void GetTags(const FInterverseAsset& Asset, TArray<FName, TInlineAllocator<8>>& OutTags);
+
+private:
+    static constexpr int32 RowsPerWord = 64;
+
+    // TagList is the "tags" metadata entry, or nullptr
+    void AddRow(const FString& AssetId, EInterverseItemCategory Category, EInterverseRarity Rarity, const FString* TagList);
+    static void ParseTags(const FString* TagList, TArray<FName, TInlineAllocator<8>>& OutTags);
+
+    void ForEachMatch(const FInterverseAssetQuery& Query, TFunctionRef<void(int32)> OnMatch) const;
+    void ClearTags(int32 Row);
+
+    // Row columns, padded to whole words so scans never need a tail loop
+    TArray<FString> AssetIds;
+    TArray<uint8> Categories;
+    TArray<uint8> Rarities;
+    TArray<uint64> LiveRows;
+    TMap<FName, TArray<uint64>> TagRows;
+
+    TMap<FString, int32> RowByAssetId;
+    TArray<int32> FreeRows;
+};
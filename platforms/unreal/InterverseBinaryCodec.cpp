@@ -0,0 +1,731 @@
+#include "InterverseBinaryCodec.h"
+#include "InterverseSchema.h"
+#include "Misc/Compression.h"
+
+namespace
+{
+    const FDateTime UnixEpoch(1970, 1, 1);
+
+    int64 ToUnixMilliseconds(const FDateTime& Date)
+    {
+        return Date.GetTicks() == 0 ? 0 : static_cast<int64>((Date - UnixEpoch).GetTotalMilliseconds());
+    }
+
+    FDateTime FromUnixMilliseconds(int64 Milliseconds)
+    {
+        return Milliseconds == 0 ? FDateTime() : UnixEpoch + FTimespan::FromMilliseconds(static_cast<double>(Milliseconds));
+    }
+
+    // Unknown enum values from newer writers fall back to the same defaults as the JSON path
+    template <typename EnumType>
+    EnumType ToEnum(uint8 Value)
+    {
+        return Value <= static_cast<uint8>(TInterverseEnumSchema<EnumType>::Last)
+            ? static_cast<EnumType>(Value) : TInterverseEnumSchema<EnumType>::Fallback;
+    }
+
+    // Overwrites OutValue in place, keeping its buffer
+    void AssignUtf8(FUtf8StringView View, FString& OutValue)
+    {
+        OutValue.Reset();
+        if (!View.IsEmpty())
+        {
+            const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(View.GetData()), View.Len());
+            OutValue.AppendChars(Converted.Get(), Converted.Length());
+        }
+    }
+
+    // Collects map keys so each is written once per record
+    class FKeyTable
+    {
+    public:
+        void Add(const FString& Key)
+        {
+            if (!Indices.Contains(Key))
+            {
+                Indices.Add(Key, Keys.Add(Key));
+            }
+        }
+
+        template <typename ValueType>
+        void AddKeys(const TMap<FString, ValueType>& Map)
+        {
+            for (const TPair<FString, ValueType>& Pair : Map)
+            {
+                Add(Pair.Key);
+            }
+        }
+
+        uint32 IndexOf(const FString& Key) const { return static_cast<uint32>(Indices.FindChecked(Key)); }
+
+        TArray<FString> Keys;
+
+    private:
+        TMap<FString, int32> Indices;
+    };
+
+    class FWriter
+    {
+    public:
+        explicit FWriter(TArray<uint8>& InBytes) : Bytes(InBytes) {}
+
+        void Header(EInterverseBinaryRecord Type)
+        {
+            Bytes.Add('I');
+            Bytes.Add('V');
+            Bytes.Add(FInterverseBinaryCodec::Version);
+            Bytes.Add(static_cast<uint8>(Type));
+        }
+
+        void Byte(uint8 Value) { Bytes.Add(Value); }
+
+        void Varint(uint64 Value)
+        {
+            do
+            {
+                uint8 Next = Value & 0x7F;
+                Value >>= 7;
+                Bytes.Add(Value ? (Next | 0x80) : Next);
+            }
+            while (Value);
+        }
+
+        void Signed(int64 Value) { Varint((static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63)); }
+
+        void Float(float Value)
+        {
+            uint32 Bits;
+            FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+            for (int32 Shift = 0; Shift < 32; Shift += 8)
+            {
+                Bytes.Add((Bits >> Shift) & 0xFF);
+            }
+        }
+
+        void String(const FString& Value)
+        {
+            FTCHARToUTF8 Utf8(*Value);
+            Varint(Utf8.Length());
+            Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+        }
+
+        void Color(const FLinearColor& Value)
+        {
+            Float(Value.R);
+            Float(Value.G);
+            Float(Value.B);
+            Float(Value.A);
+        }
+
+        void Date(const FDateTime& Value) { Signed(ToUnixMilliseconds(Value)); }
+
+        void KeyTable(const FKeyTable& Table)
+        {
+            Varint(Table.Keys.Num());
+            for (const FString& Key : Table.Keys)
+            {
+                String(Key);
+            }
+        }
+
+        void StringMap(const TMap<FString, FString>& Map, const FKeyTable& Table)
+        {
+            Varint(Map.Num());
+            for (const TPair<FString, FString>& Pair : Map)
+            {
+                Varint(Table.IndexOf(Pair.Key));
+                String(Pair.Value);
+            }
+        }
+
+    private:
+        TArray<uint8>& Bytes;
+    };
+
+    class FReader
+    {
+    public:
+        explicit FReader(TArrayView<const uint8> InBytes) : Bytes(InBytes) {}
+
+        bool Header(EInterverseBinaryRecord ExpectedType)
+        {
+            EInterverseBinaryRecord Type;
+            if (!FInterverseBinaryCodec::PeekRecordType(Bytes, Type) || Type != ExpectedType)
+            {
+                bError = true;
+                return false;
+            }
+            Offset = 4;
+            return true;
+        }
+
+        uint8 Byte()
+        {
+            if (Offset >= Bytes.Num())
+            {
+                bError = true;
+                return 0;
+            }
+            return Bytes[Offset++];
+        }
+
+        uint64 Varint()
+        {
+            uint64 Value = 0;
+            for (int32 Shift = 0; Shift < 64 && !bError; Shift += 7)
+            {
+                const uint8 Next = Byte();
+                Value |= static_cast<uint64>(Next & 0x7F) << Shift;
+                if (!(Next & 0x80))
+                {
+                    return Value;
+                }
+            }
+            bError = true;
+            return 0;
+        }
+
+        int64 Signed()
+        {
+            const uint64 Value = Varint();
+            return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+        }
+
+        float Float()
+        {
+            uint32 Bits = 0;
+            for (int32 Shift = 0; Shift < 32; Shift += 8)
+            {
+                Bits |= static_cast<uint32>(Byte()) << Shift;
+            }
+            float Value;
+            FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+            return Value;
+        }
+
+        FString String()
+        {
+            FString Value;
+            String(Value);
+            return Value;
+        }
+
+        // Overwrites OutValue in place, so a recycled record keeps its string buffers
+        void String(FString& OutValue)
+        {
+            AssignUtf8(StringView(), OutValue);
+        }
+
+        // Points into the record; valid as long as its bytes are
+        FUtf8StringView StringView()
+        {
+            const uint64 Length = Varint();
+            if (bError || Length > static_cast<uint64>(Bytes.Num() - Offset))
+            {
+                bError = true;
+                return FUtf8StringView();
+            }
+
+            const FUtf8StringView View(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData() + Offset), static_cast<int32>(Length));
+            Offset += static_cast<int32>(Length);
+            return View;
+        }
+
+        FLinearColor Color()
+        {
+            FLinearColor Value;
+            Value.R = Float();
+            Value.G = Float();
+            Value.B = Float();
+            Value.A = Float();
+            return Value;
+        }
+
+        FDateTime Date() { return FromUnixMilliseconds(Signed()); }
+
+        // Counts are bounded by the remaining bytes so corrupt input cannot force huge allocations
+        int32 Count()
+        {
+            const uint64 Value = Varint();
+            if (Value > static_cast<uint64>(Bytes.Num() - Offset))
+            {
+                bError = true;
+                return 0;
+            }
+            return static_cast<int32>(Value);
+        }
+
+        void KeyTable(TArray<FString>& OutKeys)
+        {
+            const int32 Num = Count();
+            OutKeys.Reset(Num);
+            for (int32 Index = 0; Index < Num && !bError; ++Index)
+            {
+                OutKeys.Add(String());
+            }
+        }
+
+        int32 KeyIndex(int32 NumKeys)
+        {
+            const uint64 Index = Varint();
+            if (Index >= static_cast<uint64>(NumKeys))
+            {
+                bError = true;
+                return 0;
+            }
+            return static_cast<int32>(Index);
+        }
+
+        void KeyTable(TArray<FUtf8StringView>& OutKeys)
+        {
+            const int32 Num = Count();
+            OutKeys.Reset(Num);
+            for (int32 Index = 0; Index < Num && !bError; ++Index)
+            {
+                OutKeys.Add(StringView());
+            }
+        }
+
+        template <typename KeyType>
+        const KeyType& Key(const TArray<KeyType>& Keys)
+        {
+            const int32 Index = KeyIndex(Keys.Num());
+            if (bError)
+            {
+                static const KeyType Empty;
+                return Empty;
+            }
+            return Keys[Index];
+        }
+
+        // Entries whose key comes again keep their value buffer, so recycled maps decode without allocating
+        void StringMap(TMap<FString, FString>& OutMap, const TArray<FString>& Keys)
+        {
+            const int32 Num = Count();
+            TBitArray<TInlineAllocator<4>> Written(false, Keys.Num());
+            OutMap.Reserve(Num);
+            for (int32 Index = 0; Index < Num && !bError; ++Index)
+            {
+                const int32 MapKey = KeyIndex(Keys.Num());
+                if (!bError)
+                {
+                    Written[MapKey] = true;
+                    String(OutMap.FindOrAdd(Keys[MapKey]));
+                }
+            }
+
+            for (TMap<FString, FString>::TIterator It = OutMap.CreateIterator(); It; ++It)
+            {
+                const int32 MapKey = Keys.IndexOfByKey(It.Key());
+                if (MapKey == INDEX_NONE || !Written[MapKey])
+                {
+                    It.RemoveCurrent();
+                }
+            }
+        }
+
+        // The bytes not read yet
+        TArrayView<const uint8> Rest() const { return Bytes.Slice(Offset, Bytes.Num() - Offset); }
+
+        bool IsValid() const { return !bError; }
+
+    private:
+        TArrayView<const uint8> Bytes;
+        int32 Offset = 0;
+        bool bError = false;
+    };
+
+    // Binary form of each member type. Which members are written, and in which order, comes from TInterverseSchema.
+    void WriteValue(FWriter& Writer, const FKeyTable& Keys, const FString& Value) { Writer.String(Value); }
+    void WriteValue(FWriter& Writer, const FKeyTable& Keys, int32 Value) { Writer.Signed(Value); }
+    void WriteValue(FWriter& Writer, const FKeyTable& Keys, float Value) { Writer.Float(Value); }
+    void WriteValue(FWriter& Writer, const FKeyTable& Keys, const FLinearColor& Value) { Writer.Color(Value); }
+    void WriteValue(FWriter& Writer, const FKeyTable& Keys, const FDateTime& Value) { Writer.Date(Value); }
+    void WriteValue(FWriter& Writer, const FKeyTable& Keys, const TMap<FString, FString>& Value) { Writer.StringMap(Value, Keys); }
+
+    template <typename EnumType, typename = typename TEnableIf<TIsEnum<EnumType>::Value>::Type>
+    void WriteValue(FWriter& Writer, const FKeyTable& Keys, EnumType Value) { Writer.Byte(static_cast<uint8>(Value)); }
+
+    void WriteValue(FWriter& Writer, const FKeyTable& Keys, const TMap<FString, float>& Value)
+    {
+        Writer.Varint(Value.Num());
+        for (const TPair<FString, float>& Pair : Value)
+        {
+            Writer.Varint(Keys.IndexOf(Pair.Key));
+            Writer.Float(Pair.Value);
+        }
+    }
+
+    void WriteValue(FWriter& Writer, const FKeyTable& Keys, const TArray<FString>& Value)
+    {
+        Writer.Varint(Value.Num());
+        for (const FString& Element : Value)
+        {
+            Writer.String(Element);
+        }
+    }
+
+    void ReadValue(FReader& Reader, const TArray<FString>& Keys, FString& OutValue) { Reader.String(OutValue); }
+    void ReadValue(FReader& Reader, const TArray<FString>& Keys, int32& OutValue) { OutValue = static_cast<int32>(Reader.Signed()); }
+    void ReadValue(FReader& Reader, const TArray<FString>& Keys, float& OutValue) { OutValue = Reader.Float(); }
+    void ReadValue(FReader& Reader, const TArray<FString>& Keys, FLinearColor& OutValue) { OutValue = Reader.Color(); }
+    void ReadValue(FReader& Reader, const TArray<FString>& Keys, FDateTime& OutValue) { OutValue = Reader.Date(); }
+    void ReadValue(FReader& Reader, const TArray<FString>& Keys, TMap<FString, FString>& OutValue) { Reader.StringMap(OutValue, Keys); }
+
+    template <typename EnumType, typename = typename TEnableIf<TIsEnum<EnumType>::Value>::Type>
+    void ReadValue(FReader& Reader, const TArray<FString>& Keys, EnumType& OutValue) { OutValue = ToEnum<EnumType>(Reader.Byte()); }
+
+    void ReadValue(FReader& Reader, const TArray<FString>& Keys, TMap<FString, float>& OutValue)
+    {
+        const int32 Num = Reader.Count();
+        OutValue.Reset();
+        OutValue.Reserve(Num);
+        for (int32 Index = 0; Index < Num && Reader.IsValid(); ++Index)
+        {
+            const FString& Key = Reader.Key(Keys);
+            OutValue.Add(Key, Reader.Float());
+        }
+    }
+
+    void ReadValue(FReader& Reader, const TArray<FString>& Keys, TArray<FString>& OutValue)
+    {
+        const int32 Num = Reader.Count();
+        OutValue.SetNum(Num);
+        for (int32 Index = 0; Index < Num && Reader.IsValid(); ++Index)
+        {
+            Reader.String(OutValue[Index]);
+        }
+    }
+
+    template <typename ValueType>
+    void AddValueKeys(FKeyTable& Keys, const TMap<FString, ValueType>& Value) { Keys.AddKeys(Value); }
+
+    template <typename ValueType>
+    void AddValueKeys(FKeyTable& Keys, const ValueType& Value) {}
+
+    // Map keys of all fields, in field order
+    template <typename StructType>
+    void AddRecordKeys(FKeyTable& Keys, const StructType& Record)
+    {
+        TInterverseSchema<StructType>::VisitFields([&Keys, &Record](const auto& Field)
+        {
+            AddValueKeys(Keys, Record.*Field.Member);
+        });
+    }
+
+    template <typename StructType>
+    void WriteRecordBody(FWriter& Writer, const StructType& Record, const FKeyTable& Keys)
+    {
+        TInterverseSchema<StructType>::VisitFields([&Writer, &Record, &Keys](const auto& Field)
+        {
+            WriteValue(Writer, Keys, Record.*Field.Member);
+        });
+    }
+
+    // Decodes over the existing members, so a recycled record keeps its string and map storage
+    template <typename StructType>
+    void ReadRecordBody(FReader& Reader, StructType& Record, const TArray<FString>& Keys)
+    {
+        TInterverseSchema<StructType>::VisitFields([&Reader, &Record, &Keys](const auto& Field)
+        {
+            ReadValue(Reader, Keys, Record.*Field.Member);
+        });
+    }
+
+    // Mirrors the FInterverseAsset field order of TInterverseSchema, as views
+    void ReadAssetView(FReader& Reader, FInterverseAssetView& View, const TArray<FUtf8StringView>& Keys)
+    {
+        View.AssetId = Reader.StringView();
+        View.Owner = Reader.StringView();
+        View.OwnerGlobalID = Reader.StringView();
+        View.Category = ToEnum<EInterverseItemCategory>(Reader.Byte());
+        View.Rarity = ToEnum<EInterverseRarity>(Reader.Byte());
+
+        const int32 NumMetadata = Reader.Count();
+        View.Metadata.Reset(NumMetadata);
+        for (int32 Index = 0; Index < NumMetadata && Reader.IsValid(); ++Index)
+        {
+            const FUtf8StringView& MetadataKey = Reader.Key(Keys);
+            View.Metadata.Emplace(MetadataKey, Reader.StringView());
+        }
+
+        View.GameId = Reader.StringView();
+        View.CreatedAt = Reader.Date();
+        View.ModifiedAt = Reader.Date();
+    }
+}
+
+bool FInterverseBinaryCodec::PeekRecordType(TArrayView<const uint8> Bytes, EInterverseBinaryRecord& OutType)
+{
+    if (Bytes.Num() < 4 || Bytes[0] != 'I' || Bytes[1] != 'V' || Bytes[2] != Version)
+    {
+        return false;
+    }
+
+    OutType = static_cast<EInterverseBinaryRecord>(Bytes[3]);
+    return true;
+}
+
+bool FInterverseBinaryCodec::IsCompressedFrame(TArrayView<const uint8> Bytes)
+{
+    return Bytes.Num() >= 7 && Bytes[0] == 'I' && Bytes[1] == 'Z' && Bytes[2] == Version;
+}
+
+bool FInterverseBinaryCodec::DecompressFrame(TArrayView<const uint8> Bytes, TArray<uint8>& OutPayload)
+{
+    if (!IsCompressedFrame(Bytes))
+    {
+        return false;
+    }
+
+    const uint32 InflatedSize = static_cast<uint32>(Bytes[3]) | (static_cast<uint32>(Bytes[4]) << 8)
+        | (static_cast<uint32>(Bytes[5]) << 16) | (static_cast<uint32>(Bytes[6]) << 24);
+    if (InflatedSize > static_cast<uint32>(MaxInflatedFrameSize))
+    {
+        return false;
+    }
+
+    OutPayload.SetNumUninitialized(static_cast<int32>(InflatedSize));
+    return FCompression::UncompressMemory(NAME_Zlib, OutPayload.GetData(), static_cast<int32>(InflatedSize),
+        Bytes.GetData() + 7, Bytes.Num() - 7);
+}
+
+void FInterverseBinaryCodec::EncodeProperties(const FInterverseBaseProperties& Properties, TArray<uint8>& OutBytes)
+{
+    FKeyTable Keys;
+    AddRecordKeys(Keys, Properties);
+
+    FWriter Writer(OutBytes);
+    Writer.Header(EInterverseBinaryRecord::Properties);
+    Writer.KeyTable(Keys);
+    WriteRecordBody(Writer, Properties, Keys);
+
+    // Identity block (asset id, owner, game id) is only written by the Python InterverseAsset codec
+    Writer.Byte(0);
+}
+
+bool FInterverseBinaryCodec::DecodeProperties(TArrayView<const uint8> Bytes, FInterverseBaseProperties& OutProperties)
+{
+    FReader Reader(Bytes);
+    if (!Reader.Header(EInterverseBinaryRecord::Properties))
+    {
+        return false;
+    }
+
+    TArray<FString> Keys;
+    Reader.KeyTable(Keys);
+    ReadRecordBody(Reader, OutProperties, Keys);
+
+    if (Reader.Byte() != 0)
+    {
+        // Identity fields have no counterpart on FInterverseBaseProperties
+        Reader.String();
+        Reader.String();
+        Reader.String();
+    }
+
+    return Reader.IsValid();
+}
+
+void FInterverseBinaryCodec::EncodeAsset(const FInterverseAsset& Asset, TArray<uint8>& OutBytes)
+{
+    FKeyTable Keys;
+    AddRecordKeys(Keys, Asset);
+
+    FWriter Writer(OutBytes);
+    Writer.Header(EInterverseBinaryRecord::Asset);
+    Writer.KeyTable(Keys);
+    WriteRecordBody(Writer, Asset, Keys);
+}
+
+bool FInterverseBinaryCodec::DecodeAsset(TArrayView<const uint8> Bytes, FInterverseAsset& OutAsset)
+{
+    FReader Reader(Bytes);
+    if (!Reader.Header(EInterverseBinaryRecord::Asset))
+    {
+        return false;
+    }
+
+    TArray<FString> Keys;
+    Reader.KeyTable(Keys);
+    ReadRecordBody(Reader, OutAsset, Keys);
+    return Reader.IsValid();
+}
+
+void FInterverseBinaryCodec::EncodeTransaction(const FInterverseTransaction& Transaction, TArray<uint8>& OutBytes)
+{
+    FKeyTable Keys;
+    AddRecordKeys(Keys, Transaction);
+
+    FWriter Writer(OutBytes);
+    Writer.Header(EInterverseBinaryRecord::Transaction);
+    Writer.KeyTable(Keys);
+    WriteRecordBody(Writer, Transaction, Keys);
+}
+
+bool FInterverseBinaryCodec::DecodeTransaction(TArrayView<const uint8> Bytes, FInterverseTransaction& OutTransaction)
+{
+    FReader Reader(Bytes);
+    if (!Reader.Header(EInterverseBinaryRecord::Transaction))
+    {
+        return false;
+    }
+
+    TArray<FString> Keys;
+    Reader.KeyTable(Keys);
+    ReadRecordBody(Reader, OutTransaction, Keys);
+    return Reader.IsValid();
+}
+
+void FInterverseBinaryCodec::EncodeBalance(const FString& Address, float Balance, TArray<uint8>& OutBytes)
+{
+    FWriter Writer(OutBytes);
+    Writer.Header(EInterverseBinaryRecord::Balance);
+    Writer.String(Address);
+    Writer.Float(Balance);
+}
+
+bool FInterverseBinaryCodec::DecodeBalance(TArrayView<const uint8> Bytes, FString& OutAddress, float& OutBalance)
+{
+    FReader Reader(Bytes);
+    if (!Reader.Header(EInterverseBinaryRecord::Balance))
+    {
+        return false;
+    }
+
+    Reader.String(OutAddress);
+    OutBalance = Reader.Float();
+    return Reader.IsValid();
+}
+
+void FInterverseBinaryCodec::EncodeEventFrame(int64 Sequence, TArrayView<const uint8> Record, TArray<uint8>& OutBytes)
+{
+    FWriter Writer(OutBytes);
+    Writer.Header(EInterverseBinaryRecord::Event);
+    Writer.Varint(static_cast<uint64>(Sequence));
+    OutBytes.Append(Record.GetData(), Record.Num());
+}
+
+bool FInterverseBinaryCodec::DecodeEventFrame(TArrayView<const uint8> Bytes, int64& OutSequence, TArrayView<const uint8>& OutRecord)
+{
+    FReader Reader(Bytes);
+    if (!Reader.Header(EInterverseBinaryRecord::Event))
+    {
+        return false;
+    }
+
+    OutSequence = static_cast<int64>(Reader.Varint());
+    if (!Reader.IsValid())
+    {
+        return false;
+    }
+
+    // Frames do not nest, so a hostile one cannot recurse through the decoder
+    EInterverseBinaryRecord RecordType;
+    OutRecord = Reader.Rest();
+    return PeekRecordType(OutRecord, RecordType) && RecordType != EInterverseBinaryRecord::Event;
+}
+
+void FInterverseBinaryCodec::EncodeAssetList(const TArray<FInterverseAsset>& Assets, const FDateTime& SyncedUpTo, TArray<uint8>& OutBytes)
+{
+    FKeyTable Keys;
+    for (const FInterverseAsset& Asset : Assets)
+    {
+        AddRecordKeys(Keys, Asset);
+    }
+
+    FWriter Writer(OutBytes);
+    Writer.Header(EInterverseBinaryRecord::AssetList);
+    Writer.Date(SyncedUpTo);
+    Writer.KeyTable(Keys);
+    Writer.Varint(Assets.Num());
+    for (const FInterverseAsset& Asset : Assets)
+    {
+        WriteRecordBody(Writer, Asset, Keys);
+    }
+}
+
+bool FInterverseBinaryCodec::DecodeAssetList(TArrayView<const uint8> Bytes, TArray<FInterverseAsset>& OutAssets, FDateTime& OutSyncedUpTo)
+{
+    FReader Reader(Bytes);
+    if (!Reader.Header(EInterverseBinaryRecord::AssetList))
+    {
+        return false;
+    }
+
+    OutSyncedUpTo = Reader.Date();
+
+    TArray<FString> Keys;
+    Reader.KeyTable(Keys);
+
+    const int32 Num = Reader.Count();
+    OutAssets.Reset(Num);
+    for (int32 Index = 0; Index < Num && Reader.IsValid(); ++Index)
+    {
+        ReadRecordBody(Reader, OutAssets.AddDefaulted_GetRef(), Keys);
+    }
+    return Reader.IsValid();
+}
+
+bool FInterverseBinaryCodec::DecodeAssetView(TArrayView<const uint8> Bytes, FInterverseAssetView& OutView)
+{
+    FReader Reader(Bytes);
+    if (!Reader.Header(EInterverseBinaryRecord::Asset))
+    {
+        return false;
+    }
+
+    TArray<FUtf8StringView> Keys;
+    Reader.KeyTable(Keys);
+    ReadAssetView(Reader, OutView, Keys);
+    return Reader.IsValid();
+}
+
+bool FInterverseBinaryCodec::ReadAssetList(TArrayView<const uint8> Bytes, FDateTime& OutSyncedUpTo,
+                                           TFunctionRef<void(const FInterverseAssetView&)> OnAsset)
+{
+    FReader Reader(Bytes);
+    if (!Reader.Header(EInterverseBinaryRecord::AssetList))
+    {
+        return false;
+    }
+
+    OutSyncedUpTo = Reader.Date();
+
+    TArray<FUtf8StringView> Keys;
+    Reader.KeyTable(Keys);
+
+    const int32 Num = Reader.Count();
+    FInterverseAssetView View;
+    for (int32 Index = 0; Index < Num && Reader.IsValid(); ++Index)
+    {
+        ReadAssetView(Reader, View, Keys);
+        if (Reader.IsValid())
+        {
+            OnAsset(View);
+        }
+    }
+    return Reader.IsValid();
+}
+
+void FInterverseAssetView::ToAsset(FInterverseAsset& OutAsset) const
+{
+    AssignUtf8(AssetId, OutAsset.AssetId);
+    AssignUtf8(Owner, OutAsset.Owner);
+    AssignUtf8(OwnerGlobalID, OutAsset.OwnerGlobalID);
+    OutAsset.Category = Category;
+    OutAsset.Rarity = Rarity;
+
+    OutAsset.Metadata.Reset();
+    OutAsset.Metadata.Reserve(Metadata.Num());
+    for (const TPair<FUtf8StringView, FUtf8StringView>& Pair : Metadata)
+    {
+        FString Key;
+        AssignUtf8(Pair.Key, Key);
+        AssignUtf8(Pair.Value, OutAsset.Metadata.FindOrAdd(MoveTemp(Key)));
+    }
+
+    AssignUtf8(GameId, OutAsset.GameId);
+    OutAsset.CreatedAt = CreatedAt;
+    OutAsset.ModifiedAt = ModifiedAt;
+}
@@ -0,0 +1,90 @@
+// platforms/unreal/InterverseBinaryCodec.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "InterverseTypes.h"
+
+// Record types of the compact binary encoding; must match core/codec.py
+enum class EInterverseBinaryRecord : uint8
+{
+    Properties  = 1,
+    Asset       = 2,
+    Transaction = 3,
+    Balance     = 4,
+    AssetList   = 5,
+    Event       = 6
+};
+
+/**
+ * Read-only asset decoded without copying: the strings point into the record it was read from and
+ * are only valid as long as those bytes are. For consumers that filter or forward assets and only
+ * materialize the few they keep (ToAsset).
+ */
+struct INTERVERSESDK_API FInterverseAssetView
+{
+    FUtf8StringView AssetId;
+    FUtf8StringView Owner;
+    FUtf8StringView OwnerGlobalID;
+    EInterverseItemCategory Category = EInterverseItemCategory::Cosmetic;
+    EInterverseRarity Rarity = EInterverseRarity::Common;
+    TArray<TPair<FUtf8StringView, FUtf8StringView>, TInlineAllocator<8>> Metadata;
+    FUtf8StringView GameId;
+    FDateTime CreatedAt;
+    FDateTime ModifiedAt;
+
+    // Overwrites OutAsset, reusing its string buffers
+    void ToAsset(FInterverseAsset& OutAsset) const;
+};
+
+/**
+ * Versioned compact binary encoding for Interverse records.
+ *
+ * Every record starts with 'I' 'V' <version> <record type>. Map keys are written once into a
+ * key table at the start of the record and referenced by index; integers are LEB128 varints
+ * (zigzag for signed values), floats are little-endian float32 and dates are unix milliseconds
+ * with 0 meaning unset. The same format is used for binary WebSocket frames and the local asset cache.
+ */
+class INTERVERSESDK_API FInterverseBinaryCodec
+{
+public:
+    static constexpr uint8 Version = 1;
+
+    static void EncodeProperties(const FInterverseBaseProperties& Properties, TArray<uint8>& OutBytes);
+    static bool DecodeProperties(TArrayView<const uint8> Bytes, FInterverseBaseProperties& OutProperties);
+
+    static void EncodeAsset(const FInterverseAsset& Asset, TArray<uint8>& OutBytes);
+    static bool DecodeAsset(TArrayView<const uint8> Bytes, FInterverseAsset& OutAsset);
+
+    static void EncodeTransaction(const FInterverseTransaction& Transaction, TArray<uint8>& OutBytes);
+    static bool DecodeTransaction(TArrayView<const uint8> Bytes, FInterverseTransaction& OutTransaction);
+
+    static void EncodeBalance(const FString& Address, float Balance, TArray<uint8>& OutBytes);
+    static bool DecodeBalance(TArrayView<const uint8> Bytes, FString& OutAddress, float& OutBalance);
+
+    // Assets share one key table, which keeps repeated metadata keys out of the payload
+    static void EncodeAssetList(const TArray<FInterverseAsset>& Assets, const FDateTime& SyncedUpTo, TArray<uint8>& OutBytes);
+    static bool DecodeAssetList(TArrayView<const uint8> Bytes, TArray<FInterverseAsset>& OutAssets, FDateTime& OutSyncedUpTo);
+
+    // Views into Bytes instead of copies. ReadAssetList reuses one view for all assets of the list,
+    // so OnAsset must not keep it. Decoding into an existing record with the functions above reuses
+    // its string and map storage as well.
+    static bool DecodeAssetView(TArrayView<const uint8> Bytes, FInterverseAssetView& OutView);
+    static bool ReadAssetList(TArrayView<const uint8> Bytes, FDateTime& OutSyncedUpTo,
+                              TFunctionRef<void(const FInterverseAssetView&)> OnAsset);
+
+    // WebSocket event frames: the Event header, the event's sequence number as a varint and the Asset,
+    // Balance or Transaction record. OutRecord points into Bytes.
+    static void EncodeEventFrame(int64 Sequence, TArrayView<const uint8> Record, TArray<uint8>& OutBytes);
+    static bool DecodeEventFrame(TArrayView<const uint8> Bytes, int64& OutSequence, TArrayView<const uint8>& OutRecord);
+
+    // Returns false if the bytes do not start with a header of a supported version
+    static bool PeekRecordType(TArrayView<const uint8> Bytes, EInterverseBinaryRecord& OutType);
+
+    // Compressed frames: 'I' 'Z' <version> <uint32 little-endian inflated size> <zlib stream>. The inflated
+    // payload is either a binary record or a UTF-8 JSON message.
+    static constexpr int32 MaxInflatedFrameSize = 16 * 1024 * 1024;
+
+    static bool IsCompressedFrame(TArrayView<const uint8> Bytes);
+    static bool DecompressFrame(TArrayView<const uint8> Bytes, TArray<uint8>& OutPayload);
+};
@@ -0,0 +1,101 @@
+// platforms/unreal/InterverseBoundedQueue.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Bounded lock-free queue over a preallocated ring of slots, after Dmitry Vyukov's design.
+ *
+ * Any number of threads may push; one thread at a time may pop. Slot values are constructed once
+ * and live as long as the queue: producers fill a slot in place and the consumer reads it in
+ * place, so the strings and arrays a value holds keep their allocations between laps.
+ */
+template <typename ValueType>
+class TInterverseBoundedQueue
+{
+public:
+    // Capacity is rounded up to a power of two
+    explicit TInterverseBoundedQueue(int32 InCapacity)
+    {
+        const uint32 Capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(2, InCapacity)));
+        Slots.AddDefaulted(Capacity);
+        for (uint32 Index = 0; Index < Capacity; ++Index)
+        {
+            Slots[Index].Sequence.Store(Index);
+        }
+        IndexMask = Capacity - 1;
+    }
+
+    TInterverseBoundedQueue(const TInterverseBoundedQueue&) = delete;
+    TInterverseBoundedQueue& operator=(const TInterverseBoundedQueue&) = delete;
+
+    // Any thread. Calls Fill(ValueType&) on a free slot; returns false without calling it when full.
+    template <typename FillType>
+    bool Push(FillType&& Fill)
+    {
+        uint64 Index = Head.Load(EMemoryOrder::Relaxed);
+        for (;;)
+        {
+            FSlot& Slot = Slots[static_cast<int32>(Index & IndexMask)];
+            const int64 Lag = static_cast<int64>(Slot.Sequence.Load()) - static_cast<int64>(Index);
+            if (Lag == 0)
+            {
+                // On failure CompareExchange reloads Index with the current head
+                if (Head.CompareExchange(Index, Index + 1))
+                {
+                    Fill(Slot.Value);
+                    Slot.Sequence.Store(Index + 1);
+                    return true;
+                }
+            }
+            else if (Lag < 0)
+            {
+                // The slot from one lap ago has not been consumed yet
+                return false;
+            }
+            else
+            {
+                Index = Head.Load(EMemoryOrder::Relaxed);
+            }
+        }
+    }
+
+    // Consumer only. Calls Consume(ValueType&) on the oldest slot; returns false when empty.
+    template <typename ConsumeType>
+    bool Pop(ConsumeType&& Consume)
+    {
+        FSlot& Slot = Slots[static_cast<int32>(Tail & IndexMask)];
+        if (Slot.Sequence.Load() != Tail + 1)
+        {
+            return false;
+        }
+
+        Consume(Slot.Value);
+        Slot.Sequence.Store(Tail + IndexMask + 1);
+        ++Tail;
+        return true;
+    }
+
+    // Consumer only; a push that is still filling its slot counts as not there yet
+    bool IsEmpty() const
+    {
+        return Slots[static_cast<int32>(Tail & IndexMask)].Sequence.Load() != Tail + 1;
+    }
+
+    int32 GetCapacity() const { return Slots.Num(); }
+
+private:
+    struct FSlot
+    {
+        // Index when free, Index + 1 once filled, Index + Capacity once consumed
+        TAtomic<uint64> Sequence { 0 };
+        ValueType Value;
+    };
+
+    TArray<FSlot> Slots;
+    uint64 IndexMask = 0;
+
+    // A consumer handing over to another thread must publish Tail, e.g. through an atomic flag
+    alignas(PLATFORM_CACHE_LINE_SIZE) TAtomic<uint64> Head { 0 };
+    alignas(PLATFORM_CACHE_LINE_SIZE) uint64 Tail = 0;
+};
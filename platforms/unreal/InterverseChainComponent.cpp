@@ -1,10 +1,187 @@
 #include "InterverseSDKComponent.h"
 #include "WebSocketsModule.h"
 #include "InterverseUtils.h"
+#include "InterverseConnectionSubsystem.h"
+#include "InterverseTelemetry.h"
+#include "InterverseSchema.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+DECLARE_CYCLE_STAT(TEXT("Drain Socket Events"), STAT_InterverseDrainSocketEvents, STATGROUP_Interverse);
+
+namespace
+{
+    // Shared between the chunked requests of one MintGameAssetsBatch call
+    struct FInterverseMintBatchState
+    {
+        int32 PendingChunks = 0;
+        int32 Succeeded = 0;
+        int32 Failed = 0;
+    };
+
+    // One chunk of a batch mint response as parsed off the game thread
+    struct FInterverseMintChunkResponse
+    {
+        bool bSuccess = false;
+        FString Error;
+        // One entry per item of the chunk; failed items keep a default asset
+        TArray<FInterverseAsset> Assets;
+        TArray<bool> ItemSucceeded;
+    };
+
+    // One asset page response as parsed off the game thread
+    struct FInterverseAssetPageResponse
+    {
+        FInterverseAssetPageResult Page;
+        FDateTime ServerTime;
+    };
+
+    // Shared between the parallel steps of one WarmUp call
+    struct FInterverseWarmUpState
+    {
+        int32 PendingSteps = 0;
+        double StartTime = 0.0;
+        FString GameError;
+        FInterverseWarmUpResult Result;
+        TFunction<void(const FInterverseWarmUpResult&)> OnComplete;
+
+        void FinishStep()
+        {
+            if (--PendingSteps > 0)
+            {
+                return;
+            }
+
+            Result.ElapsedMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+            Result.bSuccess = Result.bWebSocketConnected && Result.bGameVerified && Result.Balance.bSuccess && Result.Assets.bSuccess;
+            if (!Result.bWebSocketConnected)
+            {
+                Result.Error = TEXT("WebSocket did not connect");
+            }
+            else if (!Result.bGameVerified)
+            {
+                Result.Error = FString::Printf(TEXT("Game verification failed: %s"), *GameError);
+            }
+            else if (!Result.Balance.bSuccess)
+            {
+                Result.Error = FString::Printf(TEXT("Balance read failed: %s"), *Result.Balance.Error);
+            }
+            else if (!Result.Assets.bSuccess)
+            {
+                Result.Error = FString::Printf(TEXT("Asset read failed: %s"), *Result.Assets.Error);
+            }
+            OnComplete(Result);
+        }
+    };
+
+    // Shared between the chunked requests of one GetBalances call
+    struct FInterverseBalanceBatchState
+    {
+        int32 PendingRequests = 0;
+        FInterverseBalancesResult Result;
+        // Indices into Result.Balances per address, an address can be listed more than once
+        TMap<FString, TArray<int32>> Slots;
+        TFunction<void(const FInterverseBalancesResult&)> OnComplete;
+
+        void Fill(const FInterverseBalanceResult& Balance)
+        {
+            for (const int32 Index : Slots.FindRef(Balance.Address))
+            {
+                Result.Balances[Index] = Balance;
+            }
+        }
+
+        void FinishRequest()
+        {
+            if (--PendingRequests > 0)
+            {
+                return;
+            }
+
+            const int32 Failed = Result.Balances.FilterByPredicate(
+                [](const FInterverseBalanceResult& Balance) { return !Balance.bSuccess; }).Num();
+            Result.bSuccess = Failed == 0;
+            if (Failed > 0)
+            {
+                Result.Error = FString::Printf(TEXT("%d of %d balances could not be read"), Failed, Result.Balances.Num());
+            }
+            OnComplete(Result);
+        }
+    };
+
+    template <typename ResultType>
+    ResultType MakeFailedResult(const FString& Error)
+    {
+        ResultType Result;
+        Result.bSuccess = false;
+        Result.Error = Error;
+        return Result;
+    }
+
+    // Adapts a continuation-based request to a future
+    template <typename ResultType, typename RequestFunc>
+    TFuture<ResultType> MakeResultFuture(RequestFunc&& Request)
+    {
+        TSharedRef<TPromise<ResultType>> Promise = MakeShared<TPromise<ResultType>>();
+        TFuture<ResultType> Future = Promise->GetFuture();
+        Request([Promise](const ResultType& Result) { Promise->SetValue(Result); });
+        return Future;
+    }
+
+    FString SerializeCondensed(const TSharedRef<FJsonObject>& JsonObject)
+    {
+        FString Message;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+            TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Message);
+        FJsonSerializer::Serialize(JsonObject, Writer);
+        return Message;
+    }
+
+    using FCondensedJsonWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+
+    // One mint payload object, as sent alone to assets/mint and per item to assets/mint/batch
+    void WriteMintItem(FCondensedJsonWriter& Writer, const FString& OwnerAddress, const FString& GameId,
+                       const FInterverseBaseProperties& Properties, const TMap<FString, FString>& CustomProperties)
+    {
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("owner"), OwnerAddress);
+        Writer.WriteValue(TEXT("game_id"), GameId);
+        Writer.WriteValue(TEXT("asset_type"), StaticEnum<EInterverseItemCategory>()->GetNameStringByValue(static_cast<int64>(Properties.Category)));
+
+        Writer.WriteObjectStart(TEXT("metadata"));
+        InterverseSchema::WriteJson(Writer, Properties);
+        for (const TPair<FString, FString>& Pair : CustomProperties)
+        {
+            Writer.WriteValue(Pair.Key, Pair.Value);
+        }
+        Writer.WriteObjectEnd();
+
+        Writer.WriteObjectEnd();
+    }
+
+    TArray<TSharedPtr<FJsonValue>> MakeStringArray(const TArray<FString>& Values)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Reserve(Values.Num());
+        for (const FString& Value : Values)
+        {
+            Array.Add(MakeShared<FJsonValueString>(Value));
+        }
+        return Array;
+    }
+}
 
 UInterverseSDKComponent::UInterverseSDKComponent()
 {
-    PrimaryComponentTick.bCanEverTick = false;
+    // Ticking only drains decoded WebSocket events and is enabled while a socket exists
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
     Http = &FHttpModule::Get();
 }
 
@@ -21,6 +198,21 @@ void UInterverseSDKComponent::BeginPlay()
         return;
     }
 
+    RequestScheduler = MakeShared<FInterverseRequestScheduler>(MaxRequestsInFlightPerHost);
+    WorkPipeline->SetEnabled(bParseResponsesOffGameThread);
+
+    if (bUseOutbox)
+    {
+        Outbox.Open(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Interverse"), TEXT("Outbox"),
+            FPaths::MakeValidFileName(GameId) + TEXT(".journal")));
+        FlushOutbox();
+    }
+
+    if (bPersistAssetCache)
+    {
+        AssetCache.SetPersistDirectory(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Interverse"), TEXT("AssetCache")));
+    }
+
     ConnectWebSocket();
 }
 
@@ -28,105 +220,2179 @@ void UInterverseSDKComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     UE_LOG(LogTemp, Log, TEXT("InterverseSDKComponent EndPlay"));
     DisconnectWebSocket();
+    SetComponentTickEnabled(false);
+    SocketEvents.Reset();
+    SocketInbox.Reset();
+    TransferSequences.Reset();
+    SocketSession.Reset();
+    SocketTraffic.Reset();
+
+    // Journaled operations stay on disk and are sent on the next start
+    OutboxRetry.Cancel();
+    bOutboxFlushInFlight = false;
+    FailPendingRequests();
+    Outbox.Close();
+
     Super::EndPlay(EndPlayReason);
 }
 
-void UInterverseSDKComponent::CreateWallet()
+void UInterverseSDKComponent::BeginDestroy()
 {
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Http->CreateRequest();
-    Request->OnProcessRequestComplete().BindUObject(this, &UInterverseSDKComponent::OnHttpResponseReceived);
-    
-    FString Endpoint = GetEndpointPath("wallet/create");
-    Request->SetURL(FString::Printf(TEXT("%s/%s"), *NodeUrl, *Endpoint));
-    
-    Request->SetVerb("POST");
-    Request->SetHeader("Content-Type", "application/json");
-    Request->SetHeader("X-API-Key", ApiKey);
-    Request->ProcessRequest();
+    // Collected without EndPlay, e.g. a component that was never registered; futures must not be left unset
+    FailPendingRequests();
+    Super::BeginDestroy();
 }
 
-FString UInterverseSDKComponent::GetEndpointPath(const FString& Endpoint)
+void UInterverseSDKComponent::FailPendingRequests()
 {
-    FString Path = Endpoint;
-    if (!Path.StartsWith(TEXT("verse/")))
+    // The completions of cancelled reads answer their waiters; whatever is left is answered below
+    if (RequestScheduler.IsValid())
     {
-        Path = FString::Printf(TEXT("verse/%s"), *Path);
+        RequestScheduler->CancelAll();
+    }
+
+    TMap<FGuid, TResultCallback<FInterverseMintResult>> PendingMints = MoveTemp(OutboxMintCallbacks);
+    TMap<FGuid, TResultCallback<FInterverseTransferResult>> PendingTransfers = MoveTemp(OutboxTransferCallbacks);
+    OutboxMintCallbacks.Reset();
+    OutboxTransferCallbacks.Reset();
+    for (const TPair<FGuid, TResultCallback<FInterverseMintResult>>& Pair : PendingMints)
+    {
+        Pair.Value(MakeFailedResult<FInterverseMintResult>(TEXT("Not confirmed before EndPlay, kept in the outbox")));
+    }
+    for (const TPair<FGuid, TResultCallback<FInterverseTransferResult>>& Pair : PendingTransfers)
+    {
+        Pair.Value(MakeFailedResult<FInterverseTransferResult>(TEXT("Not confirmed before EndPlay, kept in the outbox")));
+    }
+
+    TMap<FString, TArray<TResultCallback<FInterverseBalanceResult>>> PendingBalances = MoveTemp(BalanceWaiters);
+    TMap<FString, TArray<TResultCallback<FInterversePlayerAssetsResult>>> PendingAssets = MoveTemp(PlayerAssetsWaiters);
+    BalanceWaiters.Reset();
+    PlayerAssetsWaiters.Reset();
+    TArray<TFunction<void(bool bConnected)>> PendingConnects = MoveTemp(WebSocketConnectWaiters);
+    WebSocketConnectWaiters.Reset();
+    for (const TPair<FString, TArray<TResultCallback<FInterverseBalanceResult>>>& Pair : PendingBalances)
+    {
+        for (const TResultCallback<FInterverseBalanceResult>& Waiter : Pair.Value)
+        {
+            Waiter(MakeFailedResult<FInterverseBalanceResult>(TEXT("Component ended play")));
+        }
+    }
+    for (const TPair<FString, TArray<TResultCallback<FInterversePlayerAssetsResult>>>& Pair : PendingAssets)
+    {
+        for (const TResultCallback<FInterversePlayerAssetsResult>& Waiter : Pair.Value)
+        {
+            Waiter(MakeFailedResult<FInterversePlayerAssetsResult>(TEXT("Component ended play")));
+        }
+    }
+    for (const TFunction<void(bool bConnected)>& Waiter : PendingConnects)
+    {
+        Waiter(false);
     }
-    return Path;
 }
 
-// Other method implementations...
+void UInterverseSDKComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    DrainSocketEvents();
+}
 
-void UInterverseSDKComponent::ConnectWebSocket()
+void UInterverseSDKComponent::DrainSocketEvents()
 {
-    UE_LOG(LogTemp, Log, TEXT("Starting WebSocket connection process..."));
+    SCOPE_CYCLE_COUNTER(STAT_InterverseDrainSocketEvents);
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UInterverseSDKComponent::DrainSocketEvents, InterverseChannel);
 
-    if (NodeUrl.IsEmpty() || ApiKey.IsEmpty())
+    if (!SocketEvents.IsValid())
     {
-        UE_LOG(LogTemp, Error, TEXT("NodeUrl or ApiKey is empty"));
         return;
     }
 
-    // Build WebSocket URL
-    FString BaseUrl = NodeUrl;
-    if (BaseUrl.StartsWith(TEXT("http://")))
+    // Highest priority first; what does not fit into the budget waits for the next tick
+    const double Deadline = FPlatformTime::Seconds() + SocketEventBudgetMs / 1000.0;
+    FInterverseSocketEvent Event;
+    while (SocketEvents->Dequeue(Event))
     {
-        BaseUrl = BaseUrl.Replace(TEXT("http://"), TEXT("wss://"));
+        DispatchSocketEvent(Event);
+        INC_DWORD_STAT(STAT_InterverseSocketEventsDispatched);
+
+        const double Now = FPlatformTime::Seconds();
+        Telemetry->Record(EInterverseOperation::SocketEventDelivery, Now - Event.EnqueueTime, true);
+        SocketEvents->Recycle(Event);
+        if (Now >= Deadline)
+        {
+            break;
+        }
     }
-    else if (BaseUrl.StartsWith(TEXT("https://")))
+    SET_DWORD_STAT(STAT_InterversePendingSocketEvents, SocketEvents->Num());
+
+    // Nothing older than the transfers seen so far can still be waiting
+    if (SocketEvents->Num() == 0)
     {
-        BaseUrl = BaseUrl.Replace(TEXT("https://"), TEXT("wss://"));
+        TransferSequences.Reset();
     }
 
-    // Clean URL
-    while (BaseUrl.EndsWith(TEXT("/")))
+    FlushCoalescedEvents();
+}
+
+void UInterverseSDKComponent::FlushCoalescedEvents()
+{
+    // Anonymous balances of several wallets could not be told apart
+    for (const TPair<FString, float>& Pair : CoalescedBalances)
     {
-        BaseUrl.RemoveAt(BaseUrl.Len() - 1);
+        OnAddressBalanceUpdated.Broadcast(Pair.Key, Pair.Value);
+        if (CoalescedBalances.Num() == 1)
+        {
+            OnBalanceUpdated.Broadcast(Pair.Value);
+        }
     }
+    CoalescedBalances.Reset();
 
-    // Add endpoint and API key
-    FString WsUrl = FString::Printf(TEXT("%s/ws?api_key=%s"), *BaseUrl, *ApiKey);
-    UE_LOG(LogTemp, Log, TEXT("Connecting to URL: %s"), *WsUrl);
+    if (CoalescedAssets.Num() > 0)
+    {
+        OnAssetsUpdated.Broadcast(CoalescedAssets);
+        CoalescedAssets.Reset();
+        CoalescedAssetIndex.Reset();
+    }
+}
 
-    // Create WebSocket
-    WebSocket = FWebSocketsModule::Get().CreateWebSocket(WsUrl);
+void UInterverseSDKComponent::DispatchSocketEvent(const FInterverseSocketEvent& Event)
+{
+    // Binary frames carry no text to forward
+    if (!Event.RawMessage.IsEmpty())
+    {
+        OnWebSocketMessage.Broadcast(Event.RawMessage);
+    }
 
-    // Set up event handlers
-    WebSocket->OnConnected().AddLambda([this]() {
-        UE_LOG(LogTemp, Log, TEXT("WebSocket Connected Successfully"));
+    switch (Event.Type)
+    {
+    case EInterverseSocketEventType::Welcome:
+        UE_LOG(LogTemp, Log, TEXT("Welcome message received for game: %s"), *GameId);
+        if (HandshakeSentTime > 0.0)
+        {
+            Telemetry->Record(EInterverseOperation::SocketRoundTrip, FPlatformTime::Seconds() - HandshakeSentTime, true);
+            HandshakeSentTime = 0.0;
+        }
+        break;
 
-        AsyncTask(ENamedThreads::GameThread, [this]() {
-            OnWebSocketConnected.Broadcast(true);
+    case EInterverseSocketEventType::AssetUpdated:
+        if (!IsSupersededByTransfer(Event))
+        {
+            DispatchAssetUpdate(Event.Asset);
+        }
+        break;
 
-            // Send handshake message
-            const FString HandshakeMessage = FString::Printf(TEXT("{\"type\":\"handshake\",\"game_id\":\"%s\"}"), *GameId);
-            WebSocket->Send(HandshakeMessage);
-        });
+    case EInterverseSocketEventType::AssetDelta:
+        if (!IsSupersededByTransfer(Event))
+        {
+            DispatchAssetDelta(Event);
+        }
+        break;
+
+    case EInterverseSocketEventType::BalanceUpdated:
+        // Pushed balances are authoritative, so a GetBalance right after needs no request
+        CachedBalances.Add(Event.Address, Event.Balance);
+        MarkReadFresh(FString::Printf(TEXT("balance:%s"), *Event.Address));
+        if (bCoalesceEvents)
+        {
+            CoalescedBalances.Add(Event.Address, Event.Balance);
+        }
+        else
+        {
+            OnBalanceUpdated.Broadcast(Event.Balance);
+            OnAddressBalanceUpdated.Broadcast(Event.Address, Event.Balance);
+        }
+        break;
+
+    case EInterverseSocketEventType::TransferComplete:
+        if (Event.Sequence > 0)
+        {
+            TransferSequences.Add(Event.Transaction.Metadata.FindRef(TEXT("asset_id")), Event.Sequence);
+        }
+        SettleTransfer(Event.Transaction.Metadata.FindRef(TEXT("asset_id")),
+            Event.Transaction.SenderAddress, Event.Transaction.RecipientAddress, Event.bSuccess,
+            TEXT("Transfer rejected by the node"));
+        OnTransferComplete.Broadcast(Event.Transaction.Metadata.FindRef(TEXT("asset_id")),
+            Event.Transaction.RecipientAddress, Event.bSuccess);
+        break;
+
+    default:
+        break;
+    }
+}
+
+bool UInterverseSDKComponent::IsSupersededByTransfer(const FInterverseSocketEvent& Event) const
+{
+    const int64* TransferSequence = TransferSequences.Find(Event.Asset.AssetId);
+    if (Event.Sequence > 0 && TransferSequence && Event.Sequence < *TransferSequence)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("Skipping update of asset %s sent before its transfer"), *Event.Asset.AssetId);
+        return true;
+    }
+    return false;
+}
+
+void UInterverseSDKComponent::DispatchAssetUpdate(const FInterverseAsset& Asset)
+{
+    AssetCache.ApplyAsset(Asset);
+    if (bCoalesceEvents)
+    {
+        if (const int32* Existing = CoalescedAssetIndex.Find(Asset.AssetId))
+        {
+            CoalescedAssets[*Existing] = Asset;
+        }
+        else
+        {
+            CoalescedAssetIndex.Add(Asset.AssetId, CoalescedAssets.Add(Asset));
+        }
+    }
+    else
+    {
+        OnAssetMinted.Broadcast(Asset, Asset.Owner);
+    }
+}
+
+void UInterverseSDKComponent::DispatchAssetDelta(const FInterverseSocketEvent& Event)
+{
+    FInterverseAsset Merged;
+    if (AssetCache.FindAsset(Event.Asset.AssetId, Merged))
+    {
+        Event.ApplyDelta(Merged);
+        DispatchAssetUpdate(Merged);
+        return;
+    }
+
+    if (Event.Asset.Owner.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Asset delta for unknown asset %s without owner, ignoring"), *Event.Asset.AssetId);
+        return;
+    }
+
+    // No version to apply the delta to; a (delta) sync of the owner's list brings the changed asset
+    const FString AssetId = Event.Asset.AssetId;
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    ReadFreshUntil.Remove(FString::Printf(TEXT("assets:%s"), *Event.Asset.Owner));
+    RequestPlayerAssets(Event.Asset.Owner, [WeakThis, AssetId](const FInterversePlayerAssetsResult& Result)
+    {
+        UInterverseSDKComponent* Self = WeakThis.Get();
+        if (!Self || !Result.bSuccess)
+        {
+            return;
+        }
+
+        if (const FInterverseAsset* Asset = Result.Assets.FindByPredicate(
+                [&AssetId](const FInterverseAsset& Candidate) { return Candidate.AssetId == AssetId; }))
+        {
+            Self->DispatchAssetUpdate(*Asset);
+        }
     });
+}
 
-    WebSocket->OnConnectionError().AddLambda([this](const FString& Error) {
-        UE_LOG(LogTemp, Error, TEXT("WebSocket Connection Error: %s"), *Error);
+void UInterverseSDKComponent::CreateWallet()
+{
+    RequestWallet([](const FInterverseWalletResult& Result)
+    {
+        if (Result.bSuccess)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Wallet created: %s"), *Result.Wallet.Address);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("Wallet creation failed: %s"), *Result.Error);
+        }
+    });
+}
+
+TFuture<FInterverseWalletResult> UInterverseSDKComponent::CreateWalletAsync()
+{
+    return MakeResultFuture<FInterverseWalletResult>([this](TResultCallback<FInterverseWalletResult> OnComplete)
+    {
+        RequestWallet(MoveTemp(OnComplete));
+    });
+}
+
+void UInterverseSDKComponent::CreateWalletWithCallback(const FOnInterverseWalletResult& OnComplete)
+{
+    RequestWallet([OnComplete](const FInterverseWalletResult& Result) { OnComplete.ExecuteIfBound(Result); });
+}
 
-        AsyncTask(ENamedThreads::GameThread, [this]() {
-            OnWebSocketConnected.Broadcast(false);
+void UInterverseSDKComponent::RequestWallet(TResultCallback<FInterverseWalletResult> OnComplete)
+{
+    OnComplete = Telemetry->Track(EInterverseOperation::CreateWallet, MoveTemp(OnComplete));
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateApiRequest("POST", "wallet/create");
+    Request->OnProcessRequestComplete().BindLambda(
+        [OnComplete](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+        {
+            FInterverseWalletResult Result;
+            TSharedPtr<FJsonObject> Data;
+            if (ParseApiResponse(Response, bSuccess, Data, Result.Error))
+            {
+                Result.Wallet.Balance = 0.0f;
+                InterverseSchema::ReadJson(*Data, Result.Wallet);
+                if (Result.Wallet.CreatedAt.GetTicks() == 0)
+                {
+                    Result.Wallet.CreatedAt = FDateTime::UtcNow();
+                }
+                if (Result.Wallet.LastUpdated.GetTicks() == 0)
+                {
+                    Result.Wallet.LastUpdated = Result.Wallet.CreatedAt;
+                }
+
+                Result.bSuccess = !Result.Wallet.Address.IsEmpty();
+                if (!Result.bSuccess)
+                {
+                    Result.Error = TEXT("Response contains no wallet address");
+                }
+            }
+            OnComplete(Result);
         });
+    SubmitRequest(Request, EInterverseRequestPriority::Interactive);
+}
+
+void UInterverseSDKComponent::GetBalance(const FString& Address)
+{
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    RequestBalance(Address, [WeakThis](const FInterverseBalanceResult& Result)
+    {
+        UInterverseSDKComponent* Self = WeakThis.Get();
+        if (Self && Result.bSuccess)
+        {
+            Self->OnBalanceUpdated.Broadcast(Result.Balance);
+            Self->OnAddressBalanceUpdated.Broadcast(Result.Address, Result.Balance);
+        }
+    });
+}
+
+TFuture<FInterverseBalanceResult> UInterverseSDKComponent::GetBalanceAsync(const FString& Address)
+{
+    return MakeResultFuture<FInterverseBalanceResult>([this, &Address](TResultCallback<FInterverseBalanceResult> OnComplete)
+    {
+        RequestBalance(Address, MoveTemp(OnComplete));
     });
+}
+
+void UInterverseSDKComponent::GetBalanceWithCallback(const FString& Address, const FOnInterverseBalanceResult& OnComplete)
+{
+    RequestBalance(Address, [OnComplete](const FInterverseBalanceResult& Result) { OnComplete.ExecuteIfBound(Result); });
+}
 
-    WebSocket->OnMessage().AddLambda([this](const FString& MessageStr) {
-        UE_LOG(LogTemp, Log, TEXT("Received message: %s"), *MessageStr);
+void UInterverseSDKComponent::RequestBalance(const FString& Address, TResultCallback<FInterverseBalanceResult> OnComplete)
+{
+    // Measured as the caller sees it: answers from memory and joined requests count too
+    OnComplete = Telemetry->Track(EInterverseOperation::GetBalance, MoveTemp(OnComplete));
+
+    if (Address.IsEmpty())
+    {
+        OnComplete(MakeFailedResult<FInterverseBalanceResult>(TEXT("Invalid address")));
+        return;
+    }
+
+    const FString ReadKey = FString::Printf(TEXT("balance:%s"), *Address);
+    if (IsReadFresh(ReadKey))
+    {
+        FInterverseBalanceResult Result;
+        Result.bSuccess = true;
+        Result.Address = Address;
+        Result.Balance = CachedBalances.FindRef(Address);
+        OnComplete(Result);
+        return;
+    }
+
+    // Join the request already pending for this address
+    if (TArray<TResultCallback<FInterverseBalanceResult>>* Waiters = BalanceWaiters.Find(ReadKey))
+    {
+        Waiters->Add(MoveTemp(OnComplete));
+        return;
+    }
+    BalanceWaiters.Add(ReadKey).Add(MoveTemp(OnComplete));
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request =
+        CreateApiRequest("GET", FString::Printf(TEXT("wallet/%s/balance"), *Address));
 
-        AsyncTask(ENamedThreads::GameThread, [this, MessageStr]() {
-            OnWebSocketMessage.Broadcast(MessageStr);
-            ProcessWebSocketMessage(MessageStr);
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    Request->OnProcessRequestComplete().BindLambda(
+        [WeakThis, Address, ReadKey](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+        {
+            // Without an entry EndPlay has already answered the waiters
+            UInterverseSDKComponent* Self = WeakThis.Get();
+            TArray<TResultCallback<FInterverseBalanceResult>> Waiters;
+            if (!Self || !Self->BalanceWaiters.RemoveAndCopyValue(ReadKey, Waiters))
+            {
+                return;
+            }
+
+            const FInterverseBalanceResult Result = Self->HandleBalanceResponse(Response, bSuccess, Address);
+            for (const TResultCallback<FInterverseBalanceResult>& Waiter : Waiters)
+            {
+                Waiter(Result);
+            }
         });
+    SubmitRequest(Request, EInterverseRequestPriority::Interactive);
+}
+
+void UInterverseSDKComponent::GetBalances(const TArray<FString>& Addresses)
+{
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    RequestBalances(Addresses, [WeakThis](const FInterverseBalancesResult& Result)
+    {
+        if (UInterverseSDKComponent* Self = WeakThis.Get())
+        {
+            Self->OnBalancesReceived.Broadcast(Result.Balances);
+        }
     });
+}
 
-    WebSocket->OnClosed().AddLambda([this](int32 StatusCode, const FString& Reason, bool bWasClean) {
-        UE_LOG(LogTemp, Warning, TEXT("WebSocket Closed: Status Code: %d, Reason: %s, Clean: %s"), 
-            StatusCode, *Reason, bWasClean ? TEXT("Yes") : TEXT("No"));
+TFuture<FInterverseBalancesResult> UInterverseSDKComponent::GetBalancesAsync(const TArray<FString>& Addresses)
+{
+    return MakeResultFuture<FInterverseBalancesResult>([this, &Addresses](TResultCallback<FInterverseBalancesResult> OnComplete)
+    {
+        RequestBalances(Addresses, MoveTemp(OnComplete));
     });
+}
 
-    WebSocket->Connect();
+void UInterverseSDKComponent::GetBalancesWithCallback(const TArray<FString>& Addresses, const FOnInterverseBalancesResult& OnComplete)
+{
+    RequestBalances(Addresses, [OnComplete](const FInterverseBalancesResult& Result) { OnComplete.ExecuteIfBound(Result); });
+}
+
+void UInterverseSDKComponent::RequestBalances(const TArray<FString>& Addresses, TResultCallback<FInterverseBalancesResult> OnComplete)
+{
+    OnComplete = Telemetry->Track(EInterverseOperation::GetBalances, MoveTemp(OnComplete));
+
+    TSharedRef<FInterverseBalanceBatchState> BatchState = MakeShared<FInterverseBalanceBatchState>();
+    BatchState->OnComplete = MoveTemp(OnComplete);
+    BatchState->Result.Balances.SetNum(Addresses.Num());
+
+    // Fresh balances are answered from memory, the rest is asked for once per address
+    TArray<FString> Missing;
+    for (int32 Index = 0; Index < Addresses.Num(); ++Index)
+    {
+        FInterverseBalanceResult& Balance = BatchState->Result.Balances[Index];
+        Balance.Address = Addresses[Index];
+        if (Balance.Address.IsEmpty())
+        {
+            Balance.Error = TEXT("Invalid address");
+        }
+        else if (IsReadFresh(FString::Printf(TEXT("balance:%s"), *Balance.Address)))
+        {
+            Balance.bSuccess = true;
+            Balance.Balance = CachedBalances.FindRef(Balance.Address);
+        }
+        else
+        {
+            TArray<int32>& Slots = BatchState->Slots.FindOrAdd(Balance.Address);
+            if (Slots.Num() == 0)
+            {
+                Missing.Add(Balance.Address);
+            }
+            Slots.Add(Index);
+        }
+    }
+
+    // Held until every request is out, so answers from memory cannot complete the batch early
+    BatchState->PendingRequests = 1;
+
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    if (bBulkBalancesUnsupported)
+    {
+        for (const FString& Address : Missing)
+        {
+            ++BatchState->PendingRequests;
+            RequestBalance(Address, [BatchState](const FInterverseBalanceResult& Balance)
+            {
+                BatchState->Fill(Balance);
+                BatchState->FinishRequest();
+            });
+        }
+        BatchState->FinishRequest();
+        return;
+    }
+
+    // The chunks go out together; the request scheduler bounds how many are in flight
+    const int32 ChunkSize = FMath::Max(1, MaxBalanceBatchSize);
+    for (int32 ChunkStart = 0; ChunkStart < Missing.Num(); ChunkStart += ChunkSize)
+    {
+        TArray<FString> Chunk(Missing.GetData() + ChunkStart, FMath::Min(ChunkSize, Missing.Num() - ChunkStart));
+
+        RequestBodyBuffer.Reset();
+        TSharedRef<FCondensedJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBodyBuffer);
+        Writer->WriteObjectStart();
+        Writer->WriteArrayStart(TEXT("addresses"));
+        for (const FString& Address : Chunk)
+        {
+            Writer->WriteValue(Address);
+        }
+        Writer->WriteArrayEnd();
+        Writer->WriteObjectEnd();
+        Writer->Close();
+
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateApiRequest("POST", "wallet/balances");
+        Request->SetContentAsString(RequestBodyBuffer);
+
+        ++BatchState->PendingRequests;
+        Request->OnProcessRequestComplete().BindLambda(
+            [WeakThis, BatchState, Chunk = MoveTemp(Chunk)](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+            {
+                UInterverseSDKComponent* Self = WeakThis.Get();
+
+                // Nodes without the bulk endpoint are asked address by address
+                if (Self && Response.IsValid() && Response->GetResponseCode() == EHttpResponseCodes::NotFound)
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("Node has no bulk balance endpoint, reading balances one by one"));
+                    Self->bBulkBalancesUnsupported = true;
+                    for (const FString& Address : Chunk)
+                    {
+                        ++BatchState->PendingRequests;
+                        Self->RequestBalance(Address, [BatchState](const FInterverseBalanceResult& Balance)
+                        {
+                            BatchState->Fill(Balance);
+                            BatchState->FinishRequest();
+                        });
+                    }
+                    BatchState->FinishRequest();
+                    return;
+                }
+
+                TSharedPtr<FJsonObject> Data;
+                FString Error;
+                const TSharedPtr<FJsonObject>* Balances = nullptr;
+                const bool bChunkSuccess = Self && ParseApiResponse(Response, bSuccess, Data, Error)
+                    && Data->TryGetObjectField(TEXT("balances"), Balances);
+                if (!Self)
+                {
+                    Error = TEXT("Component ended play");
+                }
+                else if (!bChunkSuccess)
+                {
+                    UE_LOG(LogTemp, Error, TEXT("Balance check failed for %d addresses: %s"),
+                        Chunk.Num(), Error.IsEmpty() ? TEXT("response contains no balances") : *Error);
+                }
+
+                for (const FString& Address : Chunk)
+                {
+                    FInterverseBalanceResult Balance;
+                    Balance.Address = Address;
+
+                    double Value = 0.0;
+                    if (bChunkSuccess && (*Balances)->TryGetNumberField(Address, Value))
+                    {
+                        Balance.bSuccess = true;
+                        Balance.Balance = static_cast<float>(Value);
+                        Self->CachedBalances.Add(Address, Balance.Balance);
+                        Self->MarkReadFresh(FString::Printf(TEXT("balance:%s"), *Address));
+                    }
+                    else
+                    {
+                        Balance.Error = bChunkSuccess || Error.IsEmpty() ? TEXT("Response contains no balance") : Error;
+                    }
+                    BatchState->Fill(Balance);
+                }
+                BatchState->FinishRequest();
+            });
+        SubmitRequest(Request, EInterverseRequestPriority::Normal);
+    }
+
+    BatchState->FinishRequest();
+}
+
+FInterverseBalanceResult UInterverseSDKComponent::HandleBalanceResponse(FHttpResponsePtr Response, bool bSuccess, const FString& Address)
+{
+    FInterverseBalanceResult Result;
+    Result.Address = Address;
+
+    TSharedPtr<FJsonObject> Data;
+    double Balance = 0.0;
+    if (!ParseApiResponse(Response, bSuccess, Data, Result.Error))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Balance check failed for %s: %s"), *Address, *Result.Error);
+        return Result;
+    }
+    if (!Data->TryGetNumberField(TEXT("balance"), Balance))
+    {
+        Result.Error = TEXT("Response contains no balance");
+        UE_LOG(LogTemp, Error, TEXT("Balance check failed for %s: %s"), *Address, *Result.Error);
+        return Result;
+    }
+
+    Result.bSuccess = true;
+    Result.Balance = static_cast<float>(Balance);
+    CachedBalances.Add(Address, Result.Balance);
+    MarkReadFresh(FString::Printf(TEXT("balance:%s"), *Address));
+    return Result;
+}
+
+bool UInterverseSDKComponent::IsReadFresh(const FString& Key) const
+{
+    const double* FreshUntil = ReadFreshUntil.Find(Key);
+    return FreshUntil && *FreshUntil > FPlatformTime::Seconds();
+}
+
+void UInterverseSDKComponent::MarkReadFresh(const FString& Key)
+{
+    if (ReadCacheTtlSeconds > 0.0f)
+    {
+        ReadFreshUntil.Add(Key, FPlatformTime::Seconds() + ReadCacheTtlSeconds);
+    }
+}
+
+void UInterverseSDKComponent::MintGameAsset(const FString& OwnerAddress,
+                                            const FInterverseBaseProperties& Properties,
+                                            const TMap<FString, FString>& CustomProperties)
+{
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    RequestMint(OwnerAddress, Properties, CustomProperties, [WeakThis, OwnerAddress](const FInterverseMintResult& Result)
+    {
+        UInterverseSDKComponent* Self = WeakThis.Get();
+        if (Self && Result.bSuccess)
+        {
+            Self->OnAssetMinted.Broadcast(Result.Asset, OwnerAddress);
+        }
+    });
+}
+
+TFuture<FInterverseMintResult> UInterverseSDKComponent::MintGameAssetAsync(const FString& OwnerAddress,
+                                                                           const FInterverseBaseProperties& Properties,
+                                                                           const TMap<FString, FString>& CustomProperties)
+{
+    return MakeResultFuture<FInterverseMintResult>([&](TResultCallback<FInterverseMintResult> OnComplete)
+    {
+        RequestMint(OwnerAddress, Properties, CustomProperties, MoveTemp(OnComplete));
+    });
+}
+
+void UInterverseSDKComponent::MintGameAssetWithCallback(const FString& OwnerAddress,
+                                                        const FInterverseBaseProperties& Properties,
+                                                        const TMap<FString, FString>& CustomProperties,
+                                                        const FOnInterverseMintResult& OnComplete)
+{
+    RequestMint(OwnerAddress, Properties, CustomProperties,
+        [OnComplete](const FInterverseMintResult& Result) { OnComplete.ExecuteIfBound(Result); });
+}
+
+void UInterverseSDKComponent::RequestMint(const FString& OwnerAddress,
+                                          const FInterverseBaseProperties& Properties,
+                                          const TMap<FString, FString>& CustomProperties,
+                                          TResultCallback<FInterverseMintResult> OnComplete)
+{
+    OnComplete = Telemetry->Track(EInterverseOperation::MintAsset, MoveTemp(OnComplete));
+
+    if (OwnerAddress.IsEmpty())
+    {
+        OnComplete(MakeFailedResult<FInterverseMintResult>(TEXT("Invalid owner address")));
+        return;
+    }
+
+    const FString& Body = MakeMintBody(OwnerAddress, Properties, CustomProperties);
+    if (bUseOutbox)
+    {
+        OutboxMintCallbacks.Add(Outbox.Enqueue(EInterverseOutboxOp::Mint, Body), MoveTemp(OnComplete));
+        FlushOutbox();
+        return;
+    }
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateApiRequest("POST", "assets/mint");
+    Request->SetContentAsString(Body);
+
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    Request->OnProcessRequestComplete().BindLambda(
+        [WeakThis, OnComplete](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+        {
+            const FInterverseMintResult Result = ParseMintResponse(Response, bSuccess);
+            if (UInterverseSDKComponent* Self = WeakThis.Get())
+            {
+                Self->ApplyMintResult(Result);
+            }
+            OnComplete(Result);
+        });
+    SubmitRequest(Request, EInterverseRequestPriority::Normal);
+}
+
+const FString& UInterverseSDKComponent::MakeMintBody(const FString& OwnerAddress,
+                                                     const FInterverseBaseProperties& Properties,
+                                                     const TMap<FString, FString>& CustomProperties)
+{
+    // Written straight from the properties; the buffer keeps its capacity from one mint to the next
+    RequestBodyBuffer.Reset();
+    TSharedRef<FCondensedJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBodyBuffer);
+    WriteMintItem(*Writer, OwnerAddress, GameId, Properties, CustomProperties);
+    Writer->Close();
+    return RequestBodyBuffer;
+}
+
+FInterverseMintResult UInterverseSDKComponent::ParseMintResponse(FHttpResponsePtr Response, bool bSuccess)
+{
+    FInterverseMintResult Result;
+    TSharedPtr<FJsonObject> Data;
+    if (ParseApiResponse(Response, bSuccess, Data, Result.Error))
+    {
+        Result.bSuccess = ParseAssetFromJson(Data, Result.Asset);
+        if (!Result.bSuccess)
+        {
+            Result.Error = TEXT("Response contains no asset");
+        }
+    }
+    return Result;
+}
+
+void UInterverseSDKComponent::ApplyMintResult(const FInterverseMintResult& Result)
+{
+    if (Result.bSuccess)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Asset minted: %s for %s"), *Result.Asset.AssetId, *Result.Asset.Owner);
+        AssetCache.ApplyAsset(Result.Asset);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("Asset minting failed: %s"), *Result.Error);
+    }
+}
+
+void UInterverseSDKComponent::TransferAsset(const FString& AssetId,
+                                            const FString& FromAddress,
+                                            const FString& ToAddress)
+{
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    RequestTransfer(AssetId, FromAddress, ToAddress, [WeakThis](const FInterverseTransferResult& Result)
+    {
+        if (UInterverseSDKComponent* Self = WeakThis.Get())
+        {
+            Self->OnTransferComplete.Broadcast(Result.AssetId, Result.ToAddress, Result.bSuccess);
+        }
+    });
+}
+
+TFuture<FInterverseTransferResult> UInterverseSDKComponent::TransferAssetAsync(const FString& AssetId,
+                                                                               const FString& FromAddress,
+                                                                               const FString& ToAddress)
+{
+    return MakeResultFuture<FInterverseTransferResult>([&](TResultCallback<FInterverseTransferResult> OnComplete)
+    {
+        RequestTransfer(AssetId, FromAddress, ToAddress, MoveTemp(OnComplete));
+    });
+}
+
+void UInterverseSDKComponent::TransferAssetWithCallback(const FString& AssetId,
+                                                        const FString& FromAddress,
+                                                        const FString& ToAddress,
+                                                        const FOnInterverseTransferResult& OnComplete)
+{
+    RequestTransfer(AssetId, FromAddress, ToAddress,
+        [OnComplete](const FInterverseTransferResult& Result) { OnComplete.ExecuteIfBound(Result); });
+}
+
+void UInterverseSDKComponent::RequestTransfer(const FString& AssetId,
+                                              const FString& FromAddress,
+                                              const FString& ToAddress,
+                                              TResultCallback<FInterverseTransferResult> OnComplete)
+{
+    OnComplete = Telemetry->Track(EInterverseOperation::TransferAsset, MoveTemp(OnComplete));
+
+    if (AssetId.IsEmpty() || FromAddress.IsEmpty() || ToAddress.IsEmpty())
+    {
+        FInterverseTransferResult Result = MakeFailedResult<FInterverseTransferResult>(TEXT("Missing required parameters"));
+        Result.AssetId = AssetId;
+        Result.FromAddress = FromAddress;
+        Result.ToAddress = ToAddress;
+        OnComplete(Result);
+        return;
+    }
+
+    if (bOptimisticTransfers)
+    {
+        AssetCache.BeginPendingTransfer(AssetId, FromAddress, ToAddress);
+    }
+
+    TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+    Payload->SetStringField(TEXT("asset_id"), AssetId);
+    Payload->SetStringField(TEXT("from_address"), FromAddress);
+    Payload->SetStringField(TEXT("to_address"), ToAddress);
+
+    FString Body;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Body);
+    FJsonSerializer::Serialize(Payload, Writer);
+
+    if (bUseOutbox)
+    {
+        OutboxTransferCallbacks.Add(Outbox.Enqueue(EInterverseOutboxOp::Transfer, Body), MoveTemp(OnComplete));
+        FlushOutbox();
+        return;
+    }
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateApiRequest("POST", "assets/transfer");
+    Request->SetContentAsString(Body);
+
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    Request->OnProcessRequestComplete().BindLambda(
+        [WeakThis, OnComplete, AssetId, FromAddress, ToAddress](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+        {
+            const FInterverseTransferResult Result = ParseTransferResponse(Response, bSuccess, AssetId, FromAddress, ToAddress);
+            if (UInterverseSDKComponent* Self = WeakThis.Get())
+            {
+                Self->ApplyTransferResult(Result);
+            }
+            OnComplete(Result);
+        });
+    SubmitRequest(Request, EInterverseRequestPriority::Interactive);
+}
+
+FInterverseTransferResult UInterverseSDKComponent::ParseTransferResponse(FHttpResponsePtr Response, bool bSuccess,
+                                                                         const FString& AssetId,
+                                                                         const FString& FromAddress,
+                                                                         const FString& ToAddress)
+{
+    FInterverseTransferResult Result;
+    Result.AssetId = AssetId;
+    Result.FromAddress = FromAddress;
+    Result.ToAddress = ToAddress;
+
+    TSharedPtr<FJsonObject> Data;
+    Result.bSuccess = ParseApiResponse(Response, bSuccess, Data, Result.Error);
+    if (Result.bSuccess)
+    {
+        Data->TryGetStringField(TEXT("transaction_id"), Result.TransactionId);
+    }
+    return Result;
+}
+
+void UInterverseSDKComponent::ApplyTransferResult(const FInterverseTransferResult& Result)
+{
+    if (Result.bSuccess)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Asset transferred: %s to %s"), *Result.AssetId, *Result.ToAddress);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("Asset transfer failed for %s: %s"), *Result.AssetId, *Result.Error);
+    }
+    SettleTransfer(Result.AssetId, Result.FromAddress, Result.ToAddress, Result.bSuccess, Result.Error);
+}
+
+void UInterverseSDKComponent::SettleTransfer(const FString& AssetId, const FString& FromAddress, const FString& ToAddress,
+                                             bool bSuccess, const FString& Error)
+{
+    // The HTTP response and the transfer_complete event both settle a transfer; each hop settles once, so
+    // whichever comes second is ignored and a lost response after a confirming event does not roll back
+    if (bSuccess)
+    {
+        if (!AssetCache.ConfirmTransfer(AssetId, FromAddress, ToAddress) && !AssetCache.IsTransferPending(AssetId))
+        {
+            AssetCache.MoveAsset(AssetId, FromAddress, ToAddress);
+        }
+        return;
+    }
+
+    FString PendingOwner;
+    if (AssetCache.RollbackTransfer(AssetId, FromAddress, ToAddress, PendingOwner))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Rolled back optimistic transfer of %s to %s: %s"), *AssetId, *PendingOwner, *Error);
+        OnTransferRolledBack.Broadcast(AssetId, FromAddress, PendingOwner, Error);
+    }
+}
+
+void UInterverseSDKComponent::FlushOutbox()
+{
+    if (bOutboxFlushInFlight || OutboxRetry.IsScheduled())
+    {
+        return;
+    }
+
+    TArray<FInterverseOutbox::FEntry> Batch;
+    Outbox.Peek(FMath::Max(1, OutboxFlushBatchSize), Batch);
+    if (Batch.Num() == 0)
+    {
+        return;
+    }
+
+    bOutboxFlushInFlight = true;
+    TSharedRef<int32> PendingCount = MakeShared<int32>(Batch.Num());
+    TSharedRef<bool> bNodeUnreachable = MakeShared<bool>(false);
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+
+    for (const FInterverseOutbox::FEntry& Entry : Batch)
+    {
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateApiRequest("POST", FInterverseOutbox::GetEndpoint(Entry.Op));
+        Request->SetHeader("Idempotency-Key", Entry.Key.ToString(EGuidFormats::DigitsWithHyphens));
+        Request->SetContentAsString(Entry.Body);
+
+        Request->OnProcessRequestComplete().BindLambda(
+            [WeakThis, Entry, PendingCount, bNodeUnreachable](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+            {
+                UInterverseSDKComponent* Self = WeakThis.Get();
+                if (!Self || !Self->HasBegunPlay())
+                {
+                    // Still journaled; sent again on the next start with the same idempotency key
+                    return;
+                }
+
+                if (IsRetryableFailure(Response, bSuccess))
+                {
+                    *bNodeUnreachable = true;
+                }
+                else if (Entry.Op == EInterverseOutboxOp::Mint)
+                {
+                    Self->Outbox.Acknowledge(Entry.Key);
+                    const FInterverseMintResult Result = ParseMintResponse(Response, bSuccess);
+                    Self->ApplyMintResult(Result);
+
+                    TResultCallback<FInterverseMintResult> Callback;
+                    if (Self->OutboxMintCallbacks.RemoveAndCopyValue(Entry.Key, Callback))
+                    {
+                        Callback(Result);
+                    }
+                    else if (Result.bSuccess)
+                    {
+                        // Recovered from a previous session, nobody is waiting on it
+                        Self->OnAssetMinted.Broadcast(Result.Asset, Result.Asset.Owner);
+                    }
+                }
+                else
+                {
+                    Self->Outbox.Acknowledge(Entry.Key);
+                    TSharedPtr<FJsonObject> Payload;
+                    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Entry.Body);
+                    FJsonSerializer::Deserialize(Reader, Payload);
+                    const FInterverseTransferResult Result = ParseTransferResponse(Response, bSuccess,
+                        Payload.IsValid() ? Payload->GetStringField(TEXT("asset_id")) : FString(),
+                        Payload.IsValid() ? Payload->GetStringField(TEXT("from_address")) : FString(),
+                        Payload.IsValid() ? Payload->GetStringField(TEXT("to_address")) : FString());
+                    Self->ApplyTransferResult(Result);
+
+                    TResultCallback<FInterverseTransferResult> Callback;
+                    if (Self->OutboxTransferCallbacks.RemoveAndCopyValue(Entry.Key, Callback))
+                    {
+                        Callback(Result);
+                    }
+                    else
+                    {
+                        Self->OnTransferComplete.Broadcast(Result.AssetId, Result.ToAddress, Result.bSuccess);
+                    }
+                }
+
+                if (--(*PendingCount) > 0)
+                {
+                    return;
+                }
+
+                Self->bOutboxFlushInFlight = false;
+                if (*bNodeUnreachable)
+                {
+                    // Same backoff as the sockets, but journaled work is never given up
+                    FInterverseReconnectSettings RetrySettings = Self->ReconnectSettings;
+                    RetrySettings.bEnabled = true;
+                    RetrySettings.MaxAttempts = 0;
+                    Self->OutboxRetry.Configure(RetrySettings);
+                    Self->OutboxRetry.Schedule([WeakThis]() {
+                        if (UInterverseSDKComponent* Retry = WeakThis.Get())
+                        {
+                            Retry->FlushOutbox();
+                        }
+                    });
+                }
+                else
+                {
+                    Self->OutboxRetry.ResetAttempts();
+                    Self->FlushOutbox();
+                }
+            });
+        SubmitRequest(Request, EInterverseRequestPriority::Background);
+    }
+}
+
+bool UInterverseSDKComponent::IsRetryableFailure(FHttpResponsePtr Response, bool bSuccess)
+{
+    if (!bSuccess || !Response.IsValid())
+    {
+        return true;
+    }
+
+    // Anything else is the node's final answer; resending the same operation cannot change it
+    const int32 Code = Response->GetResponseCode();
+    return Code == 0 || Code == EHttpResponseCodes::RequestTimeout || Code == EHttpResponseCodes::TooManyRequests || Code >= 500;
+}
+
+bool UInterverseSDKComponent::ParseApiResponse(FHttpResponsePtr Response, bool bSuccess,
+                                               TSharedPtr<FJsonObject>& OutData, FString& OutError)
+{
+    if (!bSuccess || !Response.IsValid())
+    {
+        OutError = TEXT("Node unreachable");
+        return false;
+    }
+    if (!EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+    {
+        OutError = FString::Printf(TEXT("HTTP %d: %s"), Response->GetResponseCode(), *Response->GetContentAsString().Left(200));
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> JsonResponse;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+    if (!FJsonSerializer::Deserialize(Reader, JsonResponse) || !JsonResponse.IsValid())
+    {
+        OutError = TEXT("Invalid JSON response");
+        return false;
+    }
+
+    bool bApiSuccess = false;
+    if (!JsonResponse->TryGetBoolField(TEXT("success"), bApiSuccess) || !bApiSuccess)
+    {
+        if (!JsonResponse->TryGetStringField(TEXT("message"), OutError))
+        {
+            OutError = TEXT("Unknown error");
+        }
+        return false;
+    }
+
+    const TSharedPtr<FJsonObject>* Data = nullptr;
+    OutData = JsonResponse->TryGetObjectField(TEXT("data"), Data) ? *Data : MakeShared<FJsonObject>();
+    return true;
+}
+
+FString UInterverseSDKComponent::GetEndpointPath(const FString& Endpoint)
+{
+    FString Path = Endpoint;
+    if (!Path.StartsWith(TEXT("verse/")))
+    {
+        Path = FString::Printf(TEXT("verse/%s"), *Path);
+    }
+    return Path;
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UInterverseSDKComponent::CreateApiRequest(const FString& Verb, const FString& Endpoint)
+{
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Http->CreateRequest();
+    Request->SetURL(FString::Printf(TEXT("%s/%s"), *NodeUrl, *GetEndpointPath(Endpoint)));
+    Request->SetVerb(Verb);
+    Request->SetHeader("Content-Type", "application/json");
+    Request->SetHeader("X-API-Key", ApiKey);
+    // Let the HTTP module keep the connection to the node open between requests
+    Request->SetHeader("Connection", "keep-alive");
+    return Request;
+}
+
+void UInterverseSDKComponent::SubmitRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, EInterverseRequestPriority Priority)
+{
+    // Requests made before BeginPlay still go through a scheduler
+    if (!RequestScheduler.IsValid())
+    {
+        RequestScheduler = MakeShared<FInterverseRequestScheduler>(MaxRequestsInFlightPerHost);
+    }
+    RequestScheduler->SetMaxInFlightPerHost(MaxRequestsInFlightPerHost);
+    RequestScheduler->Submit(Request, Priority);
+}
+
+FInterverseRequestQueueStats UInterverseSDKComponent::GetRequestQueueStats() const
+{
+    return RequestScheduler.IsValid() ? RequestScheduler->GetStats() : FInterverseRequestQueueStats();
+}
+
+FInterverseSDKStats UInterverseSDKComponent::GetStats() const
+{
+    FInterverseSDKStats Stats;
+    Telemetry->GetStats(Stats.Operations);
+    Stats.Requests = GetRequestQueueStats();
+    Stats.Socket = GetSocketTrafficStats();
+    if (bSubscribedToSharedConnection)
+    {
+        const UInterverseConnectionSubsystem* Subsystem = GetConnectionSubsystem();
+        Stats.Reconnects = Subsystem ? Subsystem->GetReconnectCount(this) : 0;
+    }
+    else
+    {
+        Stats.Reconnects = Reconnector.GetTotalAttempts();
+    }
+    if (SocketEvents.IsValid())
+    {
+        Stats.PendingSocketEvents = SocketEvents->Num();
+        Stats.PeakPendingSocketEvents = SocketEvents->GetPeakNum();
+        Stats.DroppedSocketEvents = SocketEvents->GetDroppedCount();
+    }
+    if (SocketInbox.IsValid())
+    {
+        Stats.DroppedSocketEvents += SocketInbox->GetDroppedCount();
+    }
+    Stats.PendingWorkerTasks = WorkPipeline->GetPendingCount();
+    return Stats;
+}
+
+FInterverseSocketTrafficStats UInterverseSDKComponent::GetSocketTrafficStats() const
+{
+    if (bSubscribedToSharedConnection)
+    {
+        const UInterverseConnectionSubsystem* Subsystem = GetConnectionSubsystem();
+        return Subsystem ? Subsystem->GetTrafficStats(this) : FInterverseSocketTrafficStats();
+    }
+    return SocketTraffic.IsValid() ? SocketTraffic->GetStats() : FInterverseSocketTrafficStats();
+}
+
+void UInterverseSDKComponent::MintGameAssetsBatch(const FString& OwnerAddress,
+                                                  const TArray<FInterverseBaseProperties>& Items)
+{
+    if (OwnerAddress.IsEmpty() || Items.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MintGameAssetsBatch: owner address is empty or no items given"));
+        OnBatchMintComplete.Broadcast(0, Items.Num());
+        return;
+    }
+
+    const int32 ChunkSize = FMath::Max(1, MaxMintBatchSize);
+    TSharedRef<FInterverseMintBatchState> BatchState = MakeShared<FInterverseMintBatchState>();
+    BatchState->PendingChunks = FMath::DivideAndRoundUp(Items.Num(), ChunkSize);
+
+    for (int32 ChunkStart = 0; ChunkStart < Items.Num(); ChunkStart += ChunkSize)
+    {
+        const int32 ChunkCount = FMath::Min(ChunkSize, Items.Num() - ChunkStart);
+
+        RequestBodyBuffer.Reset();
+        TSharedRef<FCondensedJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBodyBuffer);
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("owner"), OwnerAddress);
+        Writer->WriteValue(TEXT("game_id"), GameId);
+        Writer->WriteArrayStart(TEXT("items"));
+        for (int32 Index = ChunkStart; Index < ChunkStart + ChunkCount; ++Index)
+        {
+            WriteMintItem(*Writer, OwnerAddress, GameId, Items[Index], TMap<FString, FString>());
+        }
+        Writer->WriteArrayEnd();
+        Writer->WriteObjectEnd();
+        Writer->Close();
+
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateApiRequest("POST", "assets/mint/batch");
+        Request->SetContentAsString(RequestBodyBuffer);
+
+        // Each chunk is one call in the telemetry
+        const double StartTime = Telemetry->Begin(EInterverseOperation::MintBatch);
+
+        TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+        Request->OnProcessRequestComplete().BindLambda(
+            [WeakThis, WorkPipeline = WorkPipeline, Telemetry = Telemetry, StartTime, BatchState, ChunkStart, ChunkCount, OwnerAddress]
+            (FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+            {
+                WorkPipeline->Run([Response, bSuccess, ChunkCount]()
+                {
+                    FInterverseMintChunkResponse Chunk;
+                    TSharedPtr<FJsonObject> Data;
+                    const TArray<TSharedPtr<FJsonValue>>* ResultArray = nullptr;
+                    Chunk.bSuccess = ParseApiResponse(Response, bSuccess, Data, Chunk.Error)
+                        && Data->TryGetArrayField(TEXT("results"), ResultArray);
+
+                    Chunk.Assets.SetNum(ChunkCount);
+                    Chunk.ItemSucceeded.Init(false, ChunkCount);
+                    for (int32 Offset = 0; Chunk.bSuccess && Offset < ChunkCount && ResultArray->IsValidIndex(Offset); ++Offset)
+                    {
+                        const TSharedPtr<FJsonObject> ItemResult = (*ResultArray)[Offset]->AsObject();
+                        const TSharedPtr<FJsonObject>* AssetJson = nullptr;
+                        Chunk.ItemSucceeded[Offset] = ItemResult.IsValid()
+                            && ItemResult->GetBoolField(TEXT("success"))
+                            && ItemResult->TryGetObjectField(TEXT("asset"), AssetJson)
+                            && ParseAssetFromJson(*AssetJson, Chunk.Assets[Offset]);
+                    }
+                    return Chunk;
+                },
+                [WeakThis, Telemetry, StartTime, BatchState, ChunkStart, ChunkCount, OwnerAddress](FInterverseMintChunkResponse&& Chunk)
+                {
+                    Telemetry->End(EInterverseOperation::MintBatch, StartTime, Chunk.bSuccess);
+
+                    UInterverseSDKComponent* Self = WeakThis.Get();
+                    if (!Self)
+                    {
+                        return;
+                    }
+
+                    if (!Chunk.bSuccess)
+                    {
+                        UE_LOG(LogTemp, Error, TEXT("Batch mint chunk at %d failed: %s"),
+                            ChunkStart, Chunk.Error.IsEmpty() ? TEXT("response contains no results") : *Chunk.Error);
+                    }
+
+                    for (int32 Offset = 0; Offset < ChunkCount; ++Offset)
+                    {
+                        const bool bItemSuccess = Chunk.ItemSucceeded[Offset];
+                        if (bItemSuccess)
+                        {
+                            ++BatchState->Succeeded;
+                            Self->AssetCache.ApplyAsset(Chunk.Assets[Offset]);
+                            Self->OnAssetMinted.Broadcast(Chunk.Assets[Offset], OwnerAddress);
+                        }
+                        else
+                        {
+                            ++BatchState->Failed;
+                        }
+                        Self->OnBatchMintItemResult.Broadcast(ChunkStart + Offset, Chunk.Assets[Offset], bItemSuccess);
+                    }
+
+                    if (--BatchState->PendingChunks == 0)
+                    {
+                        UE_LOG(LogTemp, Log, TEXT("Batch mint finished: %d succeeded, %d failed"),
+                            BatchState->Succeeded, BatchState->Failed);
+                        Self->OnBatchMintComplete.Broadcast(BatchState->Succeeded, BatchState->Failed);
+                    }
+                });
+            });
+
+        SubmitRequest(Request, EInterverseRequestPriority::Normal);
+    }
+}
+
+void UInterverseSDKComponent::GetPlayerAssets(const FString& PlayerAddress)
+{
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    RequestPlayerAssets(PlayerAddress, [WeakThis](const FInterversePlayerAssetsResult& Result)
+    {
+        // Failed fetches still serve the cached list so the inventory can open offline
+        UInterverseSDKComponent* Self = WeakThis.Get();
+        if (Self && (Result.bSuccess || Result.bFromCache))
+        {
+            Self->OnPlayerAssetsReceived.Broadcast(Result.Address, Result.Assets);
+        }
+    });
+}
+
+TFuture<FInterversePlayerAssetsResult> UInterverseSDKComponent::GetPlayerAssetsAsync(const FString& PlayerAddress)
+{
+    return MakeResultFuture<FInterversePlayerAssetsResult>([this, &PlayerAddress](TResultCallback<FInterversePlayerAssetsResult> OnComplete)
+    {
+        RequestPlayerAssets(PlayerAddress, MoveTemp(OnComplete));
+    });
+}
+
+void UInterverseSDKComponent::GetPlayerAssetsWithCallback(const FString& PlayerAddress, const FOnInterversePlayerAssetsResult& OnComplete)
+{
+    RequestPlayerAssets(PlayerAddress, [OnComplete](const FInterversePlayerAssetsResult& Result) { OnComplete.ExecuteIfBound(Result); });
+}
+
+void UInterverseSDKComponent::StreamPlayerAssets(const FString& PlayerAddress, int32 PageSize, const FOnInterverseAssetPage& OnPage)
+{
+    TResultCallback<FInterverseAssetPageResult> Deliver = [OnPage](const FInterverseAssetPageResult& Page) { OnPage.ExecuteIfBound(Page); };
+    PageSize = PageSize > 0 ? PageSize : DefaultAssetPageSize;
+
+    if (PlayerAddress.IsEmpty())
+    {
+        UE_LOG(LogTemp, Error, TEXT("StreamPlayerAssets: player address is empty"));
+        FInterverseAssetPageResult Page = MakeFailedResult<FInterverseAssetPageResult>(TEXT("Invalid address"));
+        Page.bLastPage = true;
+        Deliver(Page);
+        return;
+    }
+
+    if (!AssetCache.IsWarm(PlayerAddress))
+    {
+        AssetCache.LoadFromDisk(PlayerAddress);
+    }
+
+    if (!AssetCache.IsWarm(PlayerAddress))
+    {
+        // Pages are merged as they come; the list only counts as complete after the last one
+        AssetCache.Invalidate(PlayerAddress);
+        StreamAssetPages(PlayerAddress, FString(), PageSize, 0, FDateTime(), MoveTemp(Deliver));
+        return;
+    }
+
+    // A warm cache only needs the (small) delta, after which the list is paged out locally
+    RequestPlayerAssets(PlayerAddress, [PageSize, Deliver = MoveTemp(Deliver)](const FInterversePlayerAssetsResult& Result)
+    {
+        FInterverseAssetPageResult Page;
+        Page.bSuccess = Result.bSuccess || Result.bFromCache;
+        Page.Error = Result.Error;
+        Page.Address = Result.Address;
+
+        const int32 NumPages = FMath::Max(1, FMath::DivideAndRoundUp(Result.Assets.Num(), PageSize));
+        for (int32 PageIndex = 0; PageIndex < NumPages && Page.bSuccess; ++PageIndex)
+        {
+            const int32 First = PageIndex * PageSize;
+            Page.Assets.Reset();
+            Page.Assets.Append(Result.Assets.GetData() + First, FMath::Min(PageSize, Result.Assets.Num() - First));
+            Page.PageIndex = PageIndex;
+            Page.bLastPage = PageIndex == NumPages - 1;
+            Deliver(Page);
+        }
+
+        if (!Page.bSuccess)
+        {
+            Page.bLastPage = true;
+            Deliver(Page);
+        }
+    });
+}
+
+void UInterverseSDKComponent::StreamAssetPages(const FString& PlayerAddress, const FString& Cursor, int32 PageSize, int32 PageIndex,
+                                               const FDateTime& SyncTime, TResultCallback<FInterverseAssetPageResult> OnPage)
+{
+    // The first page is what the player waits for; the rest can queue behind other interactive requests
+    const EInterverseRequestPriority Priority = PageIndex == 0 ? EInterverseRequestPriority::Interactive : EInterverseRequestPriority::Normal;
+
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    RequestAssetPage(PlayerAddress, Cursor, PageSize, Priority,
+        [WeakThis, PlayerAddress, PageSize, PageIndex, SyncTime, OnPage = MoveTemp(OnPage)](const FInterverseAssetPageResult& Result, const FDateTime& ServerTime)
+        {
+            FInterverseAssetPageResult Page = Result;
+            Page.PageIndex = PageIndex;
+
+            UInterverseSDKComponent* Self = WeakThis.Get();
+            if (!Self)
+            {
+                Page.bSuccess = false;
+                Page.Error = TEXT("Component destroyed");
+            }
+            if (!Page.bSuccess)
+            {
+                // A partial list stays incomplete in the cache, so the next read fetches everything again
+                Page.bLastPage = true;
+                OnPage(Page);
+                return;
+            }
+
+            // Changes made while later pages load are picked up by the next delta sync from the first page's time.
+            // Without a node time that stays unset and the next read fetches the full list.
+            const FDateTime StreamSyncTime = PageIndex == 0 ? ServerTime : SyncTime;
+
+            Self->AssetCache.MergeDelta(PlayerAddress, Page.Assets, TArray<FString>(), FDateTime());
+            if (Page.bLastPage)
+            {
+                Self->AssetCache.MarkComplete(PlayerAddress, StreamSyncTime);
+                Self->AssetCache.SaveToDisk(PlayerAddress);
+                Self->MarkReadFresh(FString::Printf(TEXT("assets:%s"), *PlayerAddress));
+            }
+
+            OnPage(Page);
+
+            if (!Page.bLastPage)
+            {
+                Self->StreamAssetPages(PlayerAddress, Page.NextCursor, PageSize, PageIndex + 1, StreamSyncTime, OnPage);
+            }
+        });
+}
+
+void UInterverseSDKComponent::GetPlayerAssetsPage(const FString& PlayerAddress, const FString& Cursor, int32 PageSize,
+                                                  const FOnInterverseAssetPage& OnComplete)
+{
+    if (PlayerAddress.IsEmpty())
+    {
+        UE_LOG(LogTemp, Error, TEXT("GetPlayerAssetsPage: player address is empty"));
+        OnComplete.ExecuteIfBound(MakeFailedResult<FInterverseAssetPageResult>(TEXT("Invalid address")));
+        return;
+    }
+
+    RequestAssetPage(PlayerAddress, Cursor, PageSize > 0 ? PageSize : DefaultAssetPageSize, EInterverseRequestPriority::Interactive,
+        [OnComplete](const FInterverseAssetPageResult& Result, const FDateTime&) { OnComplete.ExecuteIfBound(Result); });
+}
+
+void UInterverseSDKComponent::RequestAssetPage(const FString& PlayerAddress, const FString& Cursor, int32 PageSize,
+                                               EInterverseRequestPriority Priority, FAssetPageCallback OnComplete)
+{
+    const double StartTime = Telemetry->Begin(EInterverseOperation::GetAssetPage);
+    OnComplete = [Telemetry = Telemetry, StartTime, OnComplete = MoveTemp(OnComplete)]
+        (const FInterverseAssetPageResult& Page, const FDateTime& ServerTime)
+        {
+            Telemetry->End(EInterverseOperation::GetAssetPage, StartTime, Page.bSuccess);
+            OnComplete(Page, ServerTime);
+        };
+
+    FString Endpoint = GetEndpointPath(FString::Printf(TEXT("wallet/%s/assets?limit=%d"), *PlayerAddress, PageSize));
+    if (!Cursor.IsEmpty())
+    {
+        Endpoint += FString::Printf(TEXT("&cursor=%s"), *FGenericPlatformHttp::UrlEncode(Cursor));
+    }
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateApiRequest("GET", Endpoint);
+    Request->OnProcessRequestComplete().BindLambda(
+        [WorkPipeline = WorkPipeline, PlayerAddress, OnComplete = MoveTemp(OnComplete)](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+        {
+            WorkPipeline->Run([Response, bSuccess, PlayerAddress]()
+            {
+                FInterverseAssetPageResponse Parsed;
+                FInterverseAssetPageResult& Page = Parsed.Page;
+                Page.Address = PlayerAddress;
+
+                TSharedPtr<FJsonObject> Data;
+                if (!ParseApiResponse(Response, bSuccess, Data, Page.Error))
+                {
+                    UE_LOG(LogTemp, Error, TEXT("Asset page fetch failed for %s: %s"), *PlayerAddress, *Page.Error);
+                    return Parsed;
+                }
+
+                const TArray<TSharedPtr<FJsonValue>>* AssetValues = nullptr;
+                if (Data->TryGetArrayField(TEXT("assets"), AssetValues))
+                {
+                    Page.Assets.Reserve(AssetValues->Num());
+                    for (const TSharedPtr<FJsonValue>& Value : *AssetValues)
+                    {
+                        FInterverseAsset Asset;
+                        if (ParseAssetFromJson(Value->AsObject(), Asset))
+                        {
+                            Page.Assets.Add(MoveTemp(Asset));
+                        }
+                    }
+                }
+
+                // Nodes without pagination send everything at once and no cursor, which makes a single last page
+                Data->TryGetStringField(TEXT("next_cursor"), Page.NextCursor);
+                Page.bLastPage = Page.NextCursor.IsEmpty();
+                Page.bSuccess = true;
+
+                FString ServerTimeString;
+                if (Data->TryGetStringField(TEXT("server_time"), ServerTimeString))
+                {
+                    FDateTime::ParseIso8601(*ServerTimeString, Parsed.ServerTime);
+                }
+                return Parsed;
+            },
+            [OnComplete](FInterverseAssetPageResponse&& Parsed)
+            {
+                OnComplete(Parsed.Page, Parsed.ServerTime);
+            });
+        });
+    SubmitRequest(Request, Priority);
+}
+
+void UInterverseSDKComponent::RequestPlayerAssets(const FString& PlayerAddress, TResultCallback<FInterversePlayerAssetsResult> OnComplete)
+{
+    OnComplete = Telemetry->Track(EInterverseOperation::GetPlayerAssets, MoveTemp(OnComplete));
+
+    if (PlayerAddress.IsEmpty())
+    {
+        UE_LOG(LogTemp, Error, TEXT("GetPlayerAssets: player address is empty"));
+        OnComplete(MakeFailedResult<FInterversePlayerAssetsResult>(TEXT("Invalid address")));
+        return;
+    }
+
+    const FString ReadKey = FString::Printf(TEXT("assets:%s"), *PlayerAddress);
+    FInterversePlayerAssetsResult CachedResult;
+    if (IsReadFresh(ReadKey) && AssetCache.GetAssets(PlayerAddress, CachedResult.Assets))
+    {
+        CachedResult.bSuccess = true;
+        CachedResult.bFromCache = true;
+        CachedResult.Address = PlayerAddress;
+        OnComplete(CachedResult);
+        return;
+    }
+
+    // Join the request already pending for this address
+    if (TArray<TResultCallback<FInterversePlayerAssetsResult>>* Waiters = PlayerAssetsWaiters.Find(ReadKey))
+    {
+        Waiters->Add(MoveTemp(OnComplete));
+        return;
+    }
+    PlayerAssetsWaiters.Add(ReadKey).Add(MoveTemp(OnComplete));
+
+    SendPlayerAssetsRequest(PlayerAddress);
+}
+
+void UInterverseSDKComponent::SendPlayerAssetsRequest(const FString& PlayerAddress)
+{
+    if (!AssetCache.IsWarm(PlayerAddress))
+    {
+        AssetCache.LoadFromDisk(PlayerAddress);
+    }
+
+    FString Endpoint = GetEndpointPath(FString::Printf(TEXT("wallet/%s/assets"), *PlayerAddress));
+    const FInterverseAssetCache::FPlayerAssets* Cached = AssetCache.Find(PlayerAddress);
+    // A list synced without a node time cannot be resumed
+    const bool bDeltaSync = Cached && Cached->bComplete && Cached->SyncedUpTo != FDateTime();
+    if (bDeltaSync)
+    {
+        Endpoint += FString::Printf(TEXT("?modified_since=%s"), *FGenericPlatformHttp::UrlEncode(Cached->SyncedUpTo.ToIso8601()));
+    }
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateApiRequest("GET", Endpoint);
+
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    Request->OnProcessRequestComplete().BindLambda(
+        [WeakThis, WorkPipeline = WorkPipeline, PlayerAddress, bDeltaSync](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+        {
+            WorkPipeline->Run([Response, bSuccess, PlayerAddress]()
+            {
+                return ParsePlayerAssetsResponse(Response, bSuccess, PlayerAddress);
+            },
+            [WeakThis, PlayerAddress, bDeltaSync](FAssetListResponse&& Parsed)
+            {
+                UInterverseSDKComponent* Self = WeakThis.Get();
+                if (!Self)
+                {
+                    return;
+                }
+
+                FInterversePlayerAssetsResult Result;
+                if (!Self->ApplyPlayerAssetsResponse(MoveTemp(Parsed), PlayerAddress, bDeltaSync, Result))
+                {
+                    // Invalidated while the delta was in flight; the delta alone is not a complete list
+                    Self->SendPlayerAssetsRequest(PlayerAddress);
+                    return;
+                }
+
+                // Without an entry EndPlay has already answered the waiters
+                TArray<TResultCallback<FInterversePlayerAssetsResult>> Waiters;
+                if (Self->PlayerAssetsWaiters.RemoveAndCopyValue(FString::Printf(TEXT("assets:%s"), *PlayerAddress), Waiters))
+                {
+                    for (const TResultCallback<FInterversePlayerAssetsResult>& Waiter : Waiters)
+                    {
+                        Waiter(Result);
+                    }
+                }
+            });
+        });
+    SubmitRequest(Request, EInterverseRequestPriority::Interactive);
+}
+
+UInterverseSDKComponent::FAssetListResponse UInterverseSDKComponent::ParsePlayerAssetsResponse(FHttpResponsePtr Response, bool bSuccess,
+                                                                                              const FString& PlayerAddress)
+{
+    FAssetListResponse Parsed;
+
+    TSharedPtr<FJsonObject> Data;
+    if (!ParseApiResponse(Response, bSuccess, Data, Parsed.Error))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Asset fetch failed for %s: %s"), *PlayerAddress, *Parsed.Error);
+        return Parsed;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* AssetValues = nullptr;
+    if (Data->TryGetArrayField(TEXT("assets"), AssetValues))
+    {
+        Parsed.Assets.Reserve(AssetValues->Num());
+        for (const TSharedPtr<FJsonValue>& Value : *AssetValues)
+        {
+            FInterverseAsset Asset;
+            if (ParseAssetFromJson(Value->AsObject(), Asset))
+            {
+                Parsed.SyncTime = FMath::Max(Parsed.SyncTime, Asset.ModifiedAt);
+                Parsed.Assets.Add(MoveTemp(Asset));
+            }
+        }
+    }
+
+    // Prefer the node's clock for the high-water mark so client skew cannot skip changes
+    FString ServerTime;
+    if (Data->TryGetStringField(TEXT("server_time"), ServerTime))
+    {
+        FDateTime::ParseIso8601(*ServerTime, Parsed.SyncTime);
+    }
+
+    Data->TryGetStringArrayField(TEXT("removed_asset_ids"), Parsed.RemovedAssetIds);
+    Parsed.bSuccess = true;
+    return Parsed;
+}
+
+bool UInterverseSDKComponent::ApplyPlayerAssetsResponse(FAssetListResponse&& Response, const FString& PlayerAddress,
+                                                        bool bDeltaSync, FInterversePlayerAssetsResult& OutResult)
+{
+    OutResult.Address = PlayerAddress;
+
+    if (!Response.bSuccess)
+    {
+        // Still hand out what we have so the inventory can open offline
+        OutResult.Error = Response.Error;
+        OutResult.bFromCache = AssetCache.GetAssets(PlayerAddress, OutResult.Assets);
+        return true;
+    }
+
+    if (bDeltaSync && !AssetCache.IsWarm(PlayerAddress))
+    {
+        return false;
+    }
+
+    if (bDeltaSync)
+    {
+        AssetCache.MergeDelta(PlayerAddress, Response.Assets, Response.RemovedAssetIds, Response.SyncTime);
+        UE_LOG(LogTemp, Log, TEXT("Delta asset sync for %s: %d changed, %d removed"),
+            *PlayerAddress, Response.Assets.Num(), Response.RemovedAssetIds.Num());
+    }
+    else
+    {
+        // An empty list without server_time carries no node time; the previous mark still is one, and a local
+        // clock ahead of the node's would skip changes. Without either the next read fetches everything again.
+        FDateTime SyncTime = Response.SyncTime;
+        const FInterverseAssetCache::FPlayerAssets* Previous = AssetCache.Find(PlayerAddress);
+        if (SyncTime == FDateTime() && Previous)
+        {
+            SyncTime = Previous->SyncedUpTo;
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("Retrieved %d assets for %s"), Response.Assets.Num(), *PlayerAddress);
+        AssetCache.ReplaceAll(PlayerAddress, MoveTemp(Response.Assets), SyncTime);
+    }
+    AssetCache.SaveToDisk(PlayerAddress);
+    MarkReadFresh(FString::Printf(TEXT("assets:%s"), *PlayerAddress));
+
+    OutResult.bSuccess = true;
+    AssetCache.GetAssets(PlayerAddress, OutResult.Assets);
+    return true;
+}
+
+bool UInterverseSDKComponent::GetCachedPlayerAssets(const FString& PlayerAddress, TArray<FInterverseAsset>& OutAssets) const
+{
+    return AssetCache.GetAssets(PlayerAddress, OutAssets);
+}
+
+bool UInterverseSDKComponent::QueryCachedPlayerAssets(const FString& PlayerAddress, const FInterverseAssetQuery& Query,
+                                                      TArray<FInterverseAsset>& OutAssets) const
+{
+    return AssetCache.QueryAssets(PlayerAddress, Query, OutAssets);
+}
+
+void UInterverseSDKComponent::InvalidateAssetCache(const FString& PlayerAddress)
+{
+    ReadFreshUntil.Remove(FString::Printf(TEXT("assets:%s"), *PlayerAddress));
+    AssetCache.Invalidate(PlayerAddress);
+}
+
+bool UInterverseSDKComponent::ParseAssetFromJson(const TSharedPtr<FJsonObject>& JsonObject, FInterverseAsset& OutAsset)
+{
+    if (!JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    InterverseSchema::ReadJson(*JsonObject, OutAsset);
+    return !OutAsset.AssetId.IsEmpty();
+}
+
+void UInterverseSDKComponent::WarmUp(const FString& PlayerAddress)
+{
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    RequestWarmUp(PlayerAddress, [WeakThis](const FInterverseWarmUpResult& Result)
+    {
+        UInterverseSDKComponent* Self = WeakThis.Get();
+        if (!Self)
+        {
+            return;
+        }
+
+        if (!Result.bSuccess)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("WarmUp of %s incomplete: %s"), *Result.Address, *Result.Error);
+        }
+
+        // Listeners of the single reads learn about the prefetched data as well
+        if (Result.Balance.bSuccess)
+        {
+            Self->OnBalanceUpdated.Broadcast(Result.Balance.Balance);
+            Self->OnAddressBalanceUpdated.Broadcast(Result.Balance.Address, Result.Balance.Balance);
+        }
+        if (Result.Assets.bSuccess || Result.Assets.bFromCache)
+        {
+            Self->OnPlayerAssetsReceived.Broadcast(Result.Assets.Address, Result.Assets.Assets);
+        }
+        Self->OnReady.Broadcast(Result);
+    });
+}
+
+TFuture<FInterverseWarmUpResult> UInterverseSDKComponent::WarmUpAsync(const FString& PlayerAddress)
+{
+    return MakeResultFuture<FInterverseWarmUpResult>([this, &PlayerAddress](TResultCallback<FInterverseWarmUpResult> OnComplete)
+    {
+        RequestWarmUp(PlayerAddress, MoveTemp(OnComplete));
+    });
+}
+
+void UInterverseSDKComponent::WarmUpWithCallback(const FString& PlayerAddress, const FOnInterverseWarmUpResult& OnComplete)
+{
+    RequestWarmUp(PlayerAddress, [OnComplete](const FInterverseWarmUpResult& Result) { OnComplete.ExecuteIfBound(Result); });
+}
+
+void UInterverseSDKComponent::RequestWarmUp(const FString& PlayerAddress, TResultCallback<FInterverseWarmUpResult> OnComplete)
+{
+    OnComplete = Telemetry->Track(EInterverseOperation::WarmUp, MoveTemp(OnComplete));
+
+    if (PlayerAddress.IsEmpty())
+    {
+        UE_LOG(LogTemp, Error, TEXT("WarmUp: player address is empty"));
+        OnComplete(MakeFailedResult<FInterverseWarmUpResult>(TEXT("Invalid address")));
+        return;
+    }
+
+    // A component routed to explicit wallets would not hear about the player's transfers otherwise
+    if (RoutedAddresses.Num() > 0 && !RoutedAddresses.Contains(PlayerAddress))
+    {
+        SubscribeAddresses({ PlayerAddress });
+    }
+
+    TSharedRef<FInterverseWarmUpState> State = MakeShared<FInterverseWarmUpState>();
+    State->StartTime = FPlatformTime::Seconds();
+    State->Result.Address = PlayerAddress;
+    State->OnComplete = MoveTemp(OnComplete);
+    // One per step plus one released below, so steps answered from memory cannot finish the warm-up early
+    State->PendingSteps = 5;
+
+    // The handshake runs while the reads are in flight; they go out at interactive priority
+    WhenWebSocketConnected([State](bool bConnected)
+    {
+        State->Result.bWebSocketConnected = bConnected;
+        State->FinishStep();
+    });
+    RequestGameVerification([State](bool bVerified, const FString& Error)
+    {
+        State->Result.bGameVerified = bVerified;
+        State->GameError = Error;
+        State->FinishStep();
+    });
+    RequestBalance(PlayerAddress, [State](const FInterverseBalanceResult& Result)
+    {
+        State->Result.Balance = Result;
+        State->FinishStep();
+    });
+    RequestPlayerAssets(PlayerAddress, [State](const FInterversePlayerAssetsResult& Result)
+    {
+        State->Result.Assets = Result;
+        State->FinishStep();
+    });
+
+    State->FinishStep();
+}
+
+void UInterverseSDKComponent::RequestGameVerification(TFunction<void(bool bVerified, const FString& Error)> OnComplete)
+{
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateApiRequest("GET", "games/verify");
+    Request->OnProcessRequestComplete().BindLambda(
+        [OnComplete](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+        {
+            FString Error;
+            TSharedPtr<FJsonObject> Data;
+            const bool bVerified = ParseApiResponse(Response, bSuccess, Data, Error);
+            FString VerifiedGameId;
+            if (bVerified && Data->TryGetStringField(TEXT("game_id"), VerifiedGameId))
+            {
+                UE_LOG(LogTemp, Log, TEXT("Game verified: %s"), *VerifiedGameId);
+            }
+            OnComplete(bVerified, Error);
+        });
+    SubmitRequest(Request, EInterverseRequestPriority::Interactive);
+}
+
+// Other method implementations...
+
+void UInterverseSDKComponent::ConnectWebSocket()
+{
+    UE_LOG(LogTemp, Log, TEXT("Starting WebSocket connection process..."));
+
+    if (NodeUrl.IsEmpty() || ApiKey.IsEmpty())
+    {
+        UE_LOG(LogTemp, Error, TEXT("NodeUrl or ApiKey is empty"));
+        return;
+    }
+
+    // Close existing connection if any
+    DisconnectWebSocket();
+
+    // Messages are decoded on a worker thread and only typed events reach the game thread,
+    // which drains them from the queue in TickComponent. The lambdas hold the queue, not this.
+    SocketEvents = MakeShared<FInterverseSocketEventQueue, ESPMode::ThreadSafe>(MaxPendingSocketEvents);
+    SetComponentTickEnabled(true);
+
+    if (bUseSharedConnection)
+    {
+        if (UInterverseConnectionSubsystem* Subsystem = GetConnectionSubsystem())
+        {
+            UE_LOG(LogTemp, Log, TEXT("Using shared WebSocket connection for %s"), *NodeUrl);
+            Subsystem->Subscribe(this, SocketEvents, RoutedAddresses);
+            bSubscribedToSharedConnection = true;
+            return;
+        }
+        UE_LOG(LogTemp, Warning, TEXT("No game instance available, falling back to a dedicated WebSocket"));
+    }
+
+    // Kept across reconnects; a fresh component starts a fresh session
+    if (!SocketSession.IsValid())
+    {
+        SocketSession = MakeShared<FInterverseSocketSession, ESPMode::ThreadSafe>();
+        SocketTraffic = MakeShared<FInterverseSocketTraffic, ESPMode::ThreadSafe>();
+    }
+
+    // The socket thread only copies messages into the inbox; its worker decodes them into the queue,
+    // reusing the storage of events the tick has dispatched
+    TSharedRef<FInterverseSocketEventPool, ESPMode::ThreadSafe> EventPool = MakeShared<FInterverseSocketEventPool, ESPMode::ThreadSafe>();
+    SocketEvents->SetEventPool(EventPool);
+    SocketInbox = MakeShared<FInterverseSocketInbox, ESPMode::ThreadSafe>(MaxPendingSocketEvents, SocketTraffic.ToSharedRef(), EventPool,
+        [EventQueue = SocketEvents, Session = SocketSession](FInterverseSocketEvent&& Event) {
+            // Taken before the event is moved into the queue
+            const int64 Sequence = Event.Sequence;
+            const FString ResumeToken = Event.ResumeToken;
+            if (!EventQueue->Enqueue(MoveTemp(Event)))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("WebSocket event queue full (%d), dropping message"), EventQueue->GetCapacity());
+                Session->Hold(Sequence);
+                return;
+            }
+            Session->Observe(Sequence, ResumeToken);
+        });
+
+    Reconnector.Configure(ReconnectSettings);
+    Reconnector.ResetAttempts();
+
+    OpenDedicatedSocket();
+}
+
+void UInterverseSDKComponent::OpenDedicatedSocket()
+{
+    CloseDedicatedSocket();
+
+    const FString WsUrl = MakeWebSocketUrl(NodeUrl, ApiKey);
+    UE_LOG(LogTemp, Log, TEXT("Connecting to URL: %s"), *WsUrl);
+
+    // Create WebSocket
+    WebSocket = FWebSocketsModule::Get().CreateWebSocket(WsUrl);
+
+    // Set up event handlers
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    WebSocket->OnConnected().AddLambda([WeakThis]() {
+        UE_LOG(LogTemp, Log, TEXT("WebSocket Connected Successfully"));
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis]() {
+            UInterverseSDKComponent* Self = WeakThis.Get();
+            if (!Self || !Self->WebSocket.IsValid())
+            {
+                return;
+            }
+
+            Self->bDedicatedSocketConnecting = false;
+            Self->Reconnector.ResetAttempts();
+            Self->NotifyWebSocketConnected(true);
+
+            // The node is reachable again, no need to wait for the outbox backoff
+            if (Self->bUseOutbox)
+            {
+                Self->OutboxRetry.Cancel();
+                Self->FlushOutbox();
+            }
+
+            // Send handshake message; the welcome that answers it completes the SocketRoundTrip measurement
+            Self->HandshakeSentTime = FPlatformTime::Seconds();
+            Self->SendOnDedicatedSocket(MakeHandshakeMessage(Self->GameId, Self->GetSocketOptions(),
+                Self->RoutedAddresses, Self->SocketSession.Get()));
+        });
+    });
+
+    WebSocket->OnConnectionError().AddLambda([WeakThis](const FString& Error) {
+        UE_LOG(LogTemp, Error, TEXT("WebSocket Connection Error: %s"), *Error);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis]() {
+            if (UInterverseSDKComponent* Self = WeakThis.Get())
+            {
+                Self->bDedicatedSocketConnecting = false;
+                Self->NotifyWebSocketConnected(false);
+                Self->HandleDedicatedSocketLost();
+            }
+        });
+    });
+
+    SocketInbox->Bind(WebSocket, bUseBinaryFrames || bCompressSocketFrames);
+
+    WebSocket->OnClosed().AddLambda([WeakThis](int32 StatusCode, const FString& Reason, bool bWasClean) {
+        UE_LOG(LogTemp, Warning, TEXT("WebSocket Closed: Status Code: %d, Reason: %s, Clean: %s"), 
+            StatusCode, *Reason, bWasClean ? TEXT("Yes") : TEXT("No"));
+
+        // Closes we initiate unbind this handler first, so this is always the node going away
+        AsyncTask(ENamedThreads::GameThread, [WeakThis]() {
+            if (UInterverseSDKComponent* Self = WeakThis.Get())
+            {
+                Self->HandleDedicatedSocketLost();
+            }
+        });
+    });
+
+    bDedicatedSocketConnecting = true;
+    WebSocket->Connect();
+}
+
+void UInterverseSDKComponent::CloseDedicatedSocket()
+{
+    if (WebSocket.IsValid())
+    {
+        WebSocket->OnConnected().Clear();
+        WebSocket->OnConnectionError().Clear();
+        WebSocket->OnMessage().Clear();
+        WebSocket->OnRawMessage().Clear();
+        WebSocket->OnClosed().Clear();
+        WebSocket->Close();
+        WebSocket.Reset();
+    }
+    bDedicatedSocketConnecting = false;
+}
+
+void UInterverseSDKComponent::SendOnDedicatedSocket(const FString& Message)
+{
+    if (SocketTraffic.IsValid())
+    {
+        SocketTraffic->AddSent(FTCHARToUTF8(*Message).Length());
+    }
+    WebSocket->Send(Message);
+}
+
+void UInterverseSDKComponent::HandleDedicatedSocketLost()
+{
+    TWeakObjectPtr<UInterverseSDKComponent> WeakThis(this);
+    const bool bScheduled = Reconnector.Schedule([WeakThis]() {
+        if (UInterverseSDKComponent* Self = WeakThis.Get())
+        {
+            Self->OpenDedicatedSocket();
+        }
+    });
+    if (bScheduled)
+    {
+        INC_DWORD_STAT(STAT_InterverseReconnects);
+    }
+}
+
+FString UInterverseSDKComponent::MakeWebSocketUrl(const FString& InNodeUrl, const FString& InApiKey)
+{
+    // Build WebSocket URL
+    FString BaseUrl = InNodeUrl;
+    if (BaseUrl.StartsWith(TEXT("http://")))
+    {
+        BaseUrl = BaseUrl.Replace(TEXT("http://"), TEXT("wss://"));
+    }
+    else if (BaseUrl.StartsWith(TEXT("https://")))
+    {
+        BaseUrl = BaseUrl.Replace(TEXT("https://"), TEXT("wss://"));
+    }
+
+    // Clean URL
+    while (BaseUrl.EndsWith(TEXT("/")))
+    {
+        BaseUrl.RemoveAt(BaseUrl.Len() - 1);
+    }
+
+    // Add endpoint and API key
+    return FString::Printf(TEXT("%s/ws?api_key=%s"), *BaseUrl, *InApiKey);
+}
+
+FInterverseSocketOptions UInterverseSDKComponent::GetSocketOptions() const
+{
+    FInterverseSocketOptions Options;
+    Options.bBinaryFrames = bUseBinaryFrames;
+    Options.bCompressFrames = bCompressSocketFrames;
+    Options.bAssetDeltas = bRequestAssetDeltas;
+    return Options;
+}
+
+FString UInterverseSDKComponent::MakeHandshakeMessage(const FString& InGameId, const FInterverseSocketOptions& Options,
+                                                      const TArray<FString>& Addresses, const FInterverseSocketSession* Session)
+{
+    TSharedRef<FJsonObject> Handshake = MakeShared<FJsonObject>();
+    Handshake->SetStringField(TEXT("type"), TEXT("handshake"));
+    Handshake->SetStringField(TEXT("game_id"), InGameId);
+    if (Options.bBinaryFrames)
+    {
+        Handshake->SetStringField(TEXT("encoding"), TEXT("binary"));
+    }
+    if (Options.bCompressFrames)
+    {
+        Handshake->SetStringField(TEXT("compression"), TEXT("zlib"));
+    }
+    if (Options.bAssetDeltas)
+    {
+        Handshake->SetBoolField(TEXT("asset_deltas"), true);
+    }
+    if (Addresses.Num() > 0)
+    {
+        Handshake->SetArrayField(TEXT("addresses"), MakeStringArray(Addresses));
+    }
+
+    if (Session)
+    {
+        const FString ResumeToken = Session->GetResumeToken();
+        if (!ResumeToken.IsEmpty())
+        {
+            Handshake->SetStringField(TEXT("resume_token"), ResumeToken);
+        }
+        if (Session->GetLastSequence() > 0)
+        {
+            Handshake->SetNumberField(TEXT("last_seq"), static_cast<double>(Session->GetLastSequence()));
+        }
+    }
+
+    return SerializeCondensed(Handshake);
+}
+
+FString UInterverseSDKComponent::MakeSubscriptionMessage(const FString& InGameId, bool bSubscribe, const TArray<FString>& Addresses)
+{
+    TSharedRef<FJsonObject> Subscription = MakeShared<FJsonObject>();
+    Subscription->SetStringField(TEXT("type"), bSubscribe ? TEXT("subscribe") : TEXT("unsubscribe"));
+    Subscription->SetStringField(TEXT("game_id"), InGameId);
+    Subscription->SetArrayField(TEXT("addresses"), MakeStringArray(Addresses));
+    return SerializeCondensed(Subscription);
+}
+
+void UInterverseSDKComponent::DisconnectWebSocket()
+{
+    if (bSubscribedToSharedConnection)
+    {
+        if (UInterverseConnectionSubsystem* Subsystem = GetConnectionSubsystem())
+        {
+            Subsystem->Unsubscribe(this);
+        }
+        bSubscribedToSharedConnection = false;
+    }
+
+    Reconnector.Cancel();
+    CloseDedicatedSocket();
+}
+
+void UInterverseSDKComponent::SubscribeAddresses(const TArray<FString>& Addresses)
+{
+    TArray<FString> Added;
+    for (const FString& Address : Addresses)
+    {
+        if (!Address.IsEmpty() && !RoutedAddresses.Contains(Address))
+        {
+            RoutedAddresses.Add(Address);
+            Added.Add(Address);
+        }
+    }
+
+    if (Added.Num() == 0)
+    {
+        return;
+    }
+
+    if (bSubscribedToSharedConnection)
+    {
+        // The shared connection subscribes the node to the union of its components' addresses
+        if (UInterverseConnectionSubsystem* Subsystem = GetConnectionSubsystem())
+        {
+            Subsystem->UpdateAddresses(this, RoutedAddresses);
+        }
+    }
+    else if (IsWebSocketConnected())
+    {
+        SendOnDedicatedSocket(MakeSubscriptionMessage(GameId, true, Added));
+    }
+}
+
+void UInterverseSDKComponent::UnsubscribeAddresses(const TArray<FString>& Addresses)
+{
+    TArray<FString> Removed;
+    for (const FString& Address : Addresses)
+    {
+        if (RoutedAddresses.Remove(Address) > 0)
+        {
+            Removed.Add(Address);
+        }
+    }
+
+    if (Removed.Num() == 0)
+    {
+        return;
+    }
+
+    if (bSubscribedToSharedConnection)
+    {
+        if (UInterverseConnectionSubsystem* Subsystem = GetConnectionSubsystem())
+        {
+            Subsystem->UpdateAddresses(this, RoutedAddresses);
+        }
+    }
+    else if (IsWebSocketConnected())
+    {
+        SendOnDedicatedSocket(MakeSubscriptionMessage(GameId, false, Removed));
+    }
+}
+
+void UInterverseSDKComponent::SendWebSocketMessage(const FString& Message)
+{
+    if (bSubscribedToSharedConnection)
+    {
+        if (UInterverseConnectionSubsystem* Subsystem = GetConnectionSubsystem())
+        {
+            Subsystem->Send(this, Message);
+        }
+    }
+    else if (IsWebSocketConnected())
+    {
+        SendOnDedicatedSocket(Message);
+    }
+}
+
+bool UInterverseSDKComponent::IsWebSocketConnected() const
+{
+    if (bSubscribedToSharedConnection)
+    {
+        const UInterverseConnectionSubsystem* Subsystem = GetConnectionSubsystem();
+        return Subsystem && Subsystem->IsConnected(this);
+    }
+    return WebSocket.IsValid() && WebSocket->IsConnected();
+}
+
+FString UInterverseSDKComponent::GetConnectionStatus() const
+{
+    if (!WebSocket.IsValid() && !bSubscribedToSharedConnection)
+    {
+        return TEXT("Not Initialized");
+    }
+    return IsWebSocketConnected() ? TEXT("Connected") : TEXT("Disconnected");
+}
+
+void UInterverseSDKComponent::HandleSharedConnectionState(bool bConnected)
+{
+    UE_LOG(LogTemp, Log, TEXT("Shared WebSocket %s"), bConnected ? TEXT("connected") : TEXT("failed to connect"));
+    NotifyWebSocketConnected(bConnected);
+
+    // The subsystem has just sent (or already sent) the handshake of GameId
+    HandshakeSentTime = bConnected ? FPlatformTime::Seconds() : 0.0;
+
+    if (bConnected && bUseOutbox)
+    {
+        OutboxRetry.Cancel();
+        FlushOutbox();
+    }
+}
+
+void UInterverseSDKComponent::NotifyWebSocketConnected(bool bConnected)
+{
+    OnWebSocketConnected.Broadcast(bConnected);
+
+    // Waiters may start the next attempt, which queues its own waiters
+    TArray<TFunction<void(bool bConnected)>> Waiters = MoveTemp(WebSocketConnectWaiters);
+    WebSocketConnectWaiters.Reset();
+    for (const TFunction<void(bool bConnected)>& Waiter : Waiters)
+    {
+        Waiter(bConnected);
+    }
+}
+
+void UInterverseSDKComponent::WhenWebSocketConnected(TFunction<void(bool bConnected)> OnConnected)
+{
+    if (IsWebSocketConnected())
+    {
+        OnConnected(true);
+        return;
+    }
+    if (NodeUrl.IsEmpty() || ApiKey.IsEmpty())
+    {
+        OnConnected(false);
+        return;
+    }
+
+    // Join an attempt already under way, e.g. the one of BeginPlay, instead of restarting it
+    if (!bSubscribedToSharedConnection && !bDedicatedSocketConnecting && !Reconnector.IsScheduled())
+    {
+        ConnectWebSocket();
+        // A shared socket that is already open reports its state while subscribing
+        if (IsWebSocketConnected())
+        {
+            OnConnected(true);
+            return;
+        }
+    }
+
+    // Nothing answers waiters of a socket whose reconnect attempts are disabled or used up
+    bool bAttemptPending = bDedicatedSocketConnecting || Reconnector.IsScheduled();
+    if (bSubscribedToSharedConnection)
+    {
+        const UInterverseConnectionSubsystem* Subsystem = GetConnectionSubsystem();
+        bAttemptPending = Subsystem && Subsystem->IsConnecting(this);
+    }
+    if (!bAttemptPending)
+    {
+        OnConnected(false);
+        return;
+    }
+    WebSocketConnectWaiters.Add(MoveTemp(OnConnected));
+}
+
+UInterverseConnectionSubsystem* UInterverseSDKComponent::GetConnectionSubsystem() const
+{
+    const UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UInterverseConnectionSubsystem>() : nullptr;
 }
 
 // Additional method implementations...
\ No newline at end of file
@@ -2,16 +2,44 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/Future.h"
 #include "Components/ActorComponent.h"
 #include "InterverseTypes.h"
+#include "InterverseSocketEvents.h"
+#include "InterverseAssetCache.h"
+#include "InterverseRequestScheduler.h"
+#include "InterverseReconnect.h"
+#include "InterverseOutbox.h"
+#include "InterverseTelemetry.h"
+#include "InterverseWorkPipeline.h"
 #include "InterverseSDKComponent.generated.h"
 
+class UInterverseConnectionSubsystem;
+
 // Delegate declarations
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWebSocketConnected, bool, Success);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWebSocketMessage, const FString&, Message);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAssetMinted, const FInterverseAsset&, Asset, const FString&, OwnerID);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnTransferComplete, const FString&, AssetId, const FString&, PlayerID, bool, Success);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnTransferRolledBack, const FString&, AssetId, const FString&, FromAddress, const FString&, ToAddress, const FString&, Error);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBalanceUpdated, float, NewBalance);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAddressBalanceUpdated, const FString&, Address, float, NewBalance);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBalancesReceived, const TArray<FInterverseBalanceResult>&, Balances);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnBatchMintItemResult, int32, ItemIndex, const FInterverseAsset&, Asset, bool, Success);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAssetsUpdated, const TArray<FInterverseAsset>&, Assets);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPlayerAssetsReceived, const FString&, Address, const TArray<FInterverseAsset>&, Assets);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBatchMintComplete, int32, SucceededCount, int32, FailedCount);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInterverseReady, const FInterverseWarmUpResult&, Result);
+
+// Per-call completion delegates of the *WithCallback functions
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnInterverseWalletResult, const FInterverseWalletResult&, Result);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnInterverseBalanceResult, const FInterverseBalanceResult&, Result);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnInterverseBalancesResult, const FInterverseBalancesResult&, Result);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnInterverseMintResult, const FInterverseMintResult&, Result);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnInterverseTransferResult, const FInterverseTransferResult&, Result);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnInterversePlayerAssetsResult, const FInterversePlayerAssetsResult&, Result);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnInterverseAssetPage, const FInterverseAssetPageResult&, Page);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnInterverseWarmUpResult, const FInterverseWarmUpResult&, Result);
 
 UCLASS(ClassGroup=(Interverse), meta=(BlueprintSpawnableComponent))
 class INTERVERSESDK_API UInterverseSDKComponent : public UActorComponent
@@ -23,6 +51,8 @@ public:
 
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void BeginDestroy() override;
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
     // Configuration properties
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
@@ -34,6 +64,90 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
     FString ApiKey;
 
+    // Maximum number of items sent in a single batch mint request
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration", meta = (ClampMin = "1"))
+    int32 MaxMintBatchSize = 50;
+
+    // Maximum number of addresses in a single GetBalances request; the chunks are sent in parallel
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration", meta = (ClampMin = "1"))
+    int32 MaxBalanceBatchSize = 500;
+
+    // Decoded WebSocket events waiting for the game thread; further events are dropped when full
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration", meta = (ClampMin = "1"))
+    int32 MaxPendingSocketEvents = 4096;
+
+    // Game-thread time spent dispatching WebSocket events per tick. Transfers and balances are dispatched
+    // before asset updates; events over budget wait for the next tick.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration", meta = (ClampMin = "0.01"))
+    float SocketEventBudgetMs = 1.0f;
+
+    // When set, balance updates are collapsed to the latest value per address (see OnAddressBalanceUpdated) and asset events
+    // are delivered through OnAssetsUpdated once per tick instead of one OnAssetMinted each
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    bool bCoalesceEvents = false;
+
+    // Share one WebSocket per NodeUrl/ApiKey through UInterverseConnectionSubsystem instead of opening one per component
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    bool bUseSharedConnection = false;
+
+    // Wallets whose events the node sends to this component, see SubscribeAddresses; empty receives every event of GameId
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    TArray<FString> RoutedAddresses;
+
+    // Ask the node to send asset changes as deltas of the changed fields instead of full asset documents
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    bool bRequestAssetDeltas = true;
+
+    // Keep fetched asset lists under Saved/Interverse/AssetCache so warm starts only download deltas
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    bool bPersistAssetCache = false;
+
+    // Ask the node for binary event frames (FInterverseBinaryCodec) instead of JSON text
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    bool bUseBinaryFrames = false;
+
+    // Ask the node to zlib-compress every event frame. Worth it for asset events with large metadata maps;
+    // combine with bUseBinaryFrames for the smallest frames. GetSocketTrafficStats shows the bytes saved.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    bool bCompressSocketFrames = false;
+
+    // Dropped WebSocket connections are re-opened with backoff and resume from the last received event
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    FInterverseReconnectSettings ReconnectSettings;
+
+    // Journal mints and transfers under Saved/Interverse/Outbox and send them in the background, so they
+    // survive disconnects and restarts. Results arrive whenever the node has confirmed the operation.
+    // MintGameAssetsBatch bypasses the outbox.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    bool bUseOutbox = false;
+
+    // Move the asset in the asset cache as soon as TransferAsset is called, tagged bPendingTransfer, instead of
+    // after the node confirms. A rejected transfer is moved back and raises OnTransferRolledBack.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    bool bOptimisticTransfers = false;
+
+    // Journaled operations sent per flush; the next batch waits until the previous one has completed
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration", meta = (ClampMin = "1"))
+    int32 OutboxFlushBatchSize = 20;
+
+    // Page size of StreamPlayerAssets/GetPlayerAssetsPage when called with PageSize 0
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration", meta = (ClampMin = "1"))
+    int32 DefaultAssetPageSize = 100;
+
+    // HTTP requests sent concurrently to the node; the rest wait in priority order
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration", meta = (ClampMin = "1"))
+    int32 MaxRequestsInFlightPerHost = 6;
+
+    // Seconds a GetBalance/GetPlayerAssets result is answered from memory; 0 always asks the node.
+    // Identical reads already in flight are never sent twice.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration", meta = (ClampMin = "0"))
+    float ReadCacheTtlSeconds = 2.0f;
+
+    // Parse asset lists, asset pages and batch mint results on a background thread; the game thread only
+    // updates the caches and broadcasts. False parses them inline on the game thread. Read at BeginPlay.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Configuration")
+    bool bParseResponsesOffGameThread = true;
+
     // Blockchain functions
     UFUNCTION(BlueprintCallable, Category = "Interverse|Wallet")
     void CreateWallet();
@@ -41,19 +155,103 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Interverse|Wallet")
     void GetBalance(const FString& Address);
 
+    // Reads many balances in one request per MaxBalanceBatchSize addresses and raises OnBalancesReceived.
+    // Fresh cached balances are not asked for again.
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Wallet")
+    void GetBalances(const TArray<FString>& Addresses);
+
     UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
     void MintGameAsset(const FString& OwnerAddress, 
                       const FInterverseBaseProperties& Properties,
                       const TMap<FString, FString>& CustomProperties);
 
+    // Mints all items in as few requests as possible, chunked by MaxMintBatchSize. Batches are sent
+    // directly and not journaled even with bUseOutbox; failed items are reported in OnBatchMintItemResult.
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
+    void MintGameAssetsBatch(const FString& OwnerAddress,
+                            const TArray<FInterverseBaseProperties>& Items);
+
     UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
     void TransferAsset(const FString& AssetId, 
                       const FString& FromAddress, 
                       const FString& ToAddress);
 
+    // Downloads the full list once, then only assets modified since the last sync
     UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
     void GetPlayerAssets(const FString& PlayerAddress);
 
+    // Returns false if no complete list is cached for the address yet
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
+    bool GetCachedPlayerAssets(const FString& PlayerAddress, TArray<FInterverseAsset>& OutAssets) const;
+
+    // Filters the cached list through its column index, e.g. for inventory search as the player types.
+    // Returns false if no complete list is cached for the address yet.
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
+    bool QueryCachedPlayerAssets(const FString& PlayerAddress, const FInterverseAssetQuery& Query,
+                                 TArray<FInterverseAsset>& OutAssets) const;
+
+    // Drops the cached list so the next GetPlayerAssets downloads everything again
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
+    void InvalidateAssetCache(const FString& PlayerAddress);
+
+    // Per-call variants: only the caller receives the result, the multicast events are not raised.
+    // Futures are fulfilled and callbacks run on the game thread.
+    TFuture<FInterverseWalletResult> CreateWalletAsync();
+    TFuture<FInterverseBalanceResult> GetBalanceAsync(const FString& Address);
+    TFuture<FInterverseBalancesResult> GetBalancesAsync(const TArray<FString>& Addresses);
+    TFuture<FInterverseMintResult> MintGameAssetAsync(const FString& OwnerAddress,
+                                                      const FInterverseBaseProperties& Properties,
+                                                      const TMap<FString, FString>& CustomProperties);
+    TFuture<FInterverseTransferResult> TransferAssetAsync(const FString& AssetId,
+                                                          const FString& FromAddress,
+                                                          const FString& ToAddress);
+    TFuture<FInterversePlayerAssetsResult> GetPlayerAssetsAsync(const FString& PlayerAddress);
+    TFuture<FInterverseWarmUpResult> WarmUpAsync(const FString& PlayerAddress);
+
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Wallet")
+    void CreateWalletWithCallback(const FOnInterverseWalletResult& OnComplete);
+
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Wallet")
+    void GetBalanceWithCallback(const FString& Address, const FOnInterverseBalanceResult& OnComplete);
+
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Wallet")
+    void GetBalancesWithCallback(const TArray<FString>& Addresses, const FOnInterverseBalancesResult& OnComplete);
+
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
+    void MintGameAssetWithCallback(const FString& OwnerAddress,
+                                   const FInterverseBaseProperties& Properties,
+                                   const TMap<FString, FString>& CustomProperties,
+                                   const FOnInterverseMintResult& OnComplete);
+
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
+    void TransferAssetWithCallback(const FString& AssetId,
+                                   const FString& FromAddress,
+                                   const FString& ToAddress,
+                                   const FOnInterverseTransferResult& OnComplete);
+
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
+    void GetPlayerAssetsWithCallback(const FString& PlayerAddress, const FOnInterversePlayerAssetsResult& OnComplete);
+
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Network")
+    void WarmUpWithCallback(const FString& PlayerAddress, const FOnInterverseWarmUpResult& OnComplete);
+
+    // Hands out the player's assets in pages of PageSize as they arrive, so an inventory can show the first page
+    // right away. Pages also fill the asset cache; a warm cache is synced and then paged locally.
+    // OnPage fires until a page with bLastPage set or a failed page.
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
+    void StreamPlayerAssets(const FString& PlayerAddress, int32 PageSize, const FOnInterverseAssetPage& OnPage);
+
+    // Fetches a single page, starting with an empty Cursor; bypasses the asset cache
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Assets")
+    void GetPlayerAssetsPage(const FString& PlayerAddress, const FString& Cursor, int32 PageSize,
+                             const FOnInterverseAssetPage& OnComplete);
+
+    // Login prefetch: connects the WebSocket unless it is connected or connecting, verifies the game and reads the
+    // balance and assets of PlayerAddress, all at the same time instead of one round trip after the other.
+    // Raises OnReady once every step has finished; the balance and asset caches are warm from then on.
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Network")
+    void WarmUp(const FString& PlayerAddress);
+
     // Network functions
     UFUNCTION(BlueprintCallable, Category = "Interverse|Network")
     void ConnectWebSocket();
@@ -64,12 +262,56 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Interverse|Network")
     void SendWebSocketMessage(const FString& Message);
 
+    // Adds wallets to RoutedAddresses and tells the node, which then only sends events of the subscribed wallets
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Network")
+    void SubscribeAddresses(const TArray<FString>& Addresses);
+
+    // Removing the last subscribed wallet goes back to receiving every event of GameId
+    UFUNCTION(BlueprintCallable, Category = "Interverse|Network")
+    void UnsubscribeAddresses(const TArray<FString>& Addresses);
+
     UFUNCTION(BlueprintPure, Category = "Interverse|Network")
     bool IsWebSocketConnected() const;
 
     UFUNCTION(BlueprintPure, Category = "Interverse|Network")
     FString GetConnectionStatus() const;
 
+    UFUNCTION(BlueprintPure, Category = "Interverse|Network")
+    FInterverseRequestQueueStats GetRequestQueueStats() const;
+
+    // Bytes received, decoded and sent on this component's WebSocket (the shared one with bUseSharedConnection)
+    UFUNCTION(BlueprintPure, Category = "Interverse|Network")
+    FInterverseSocketTrafficStats GetSocketTrafficStats() const;
+
+    // Call counts, failures and latency percentiles per operation, plus request, socket and reconnect counters.
+    // The same numbers show live in "stat Interverse" and on the Interverse Insights trace channel.
+    UFUNCTION(BlueprintPure, Category = "Interverse|Network")
+    FInterverseSDKStats GetStats() const;
+
+    // Mints and transfers journaled but not yet confirmed by the node (bUseOutbox)
+    UFUNCTION(BlueprintPure, Category = "Interverse|Network")
+    int32 GetPendingOutboxCount() const { return Outbox.Num(); }
+
+    // True while an optimistic transfer of the asset waits for the node (bOptimisticTransfers)
+    UFUNCTION(BlueprintPure, Category = "Interverse|Assets")
+    bool IsTransferPending(const FString& AssetId) const { return AssetCache.IsTransferPending(AssetId); }
+
+    // Thread-safe; used by the WebSocket decode workers
+    static bool ParseAssetFromJson(const TSharedPtr<FJsonObject>& JsonObject, FInterverseAsset& OutAsset);
+
+    static FString MakeWebSocketUrl(const FString& InNodeUrl, const FString& InApiKey);
+    FInterverseSocketOptions GetSocketOptions() const;
+
+    // Addresses restricts the events the node sends (empty sends all of the game). Session, when given, adds the
+    // resume token and last received sequence so the node replays only missed events.
+    static FString MakeHandshakeMessage(const FString& InGameId, const FInterverseSocketOptions& Options,
+                                        const TArray<FString>& Addresses, const FInterverseSocketSession* Session = nullptr);
+    // {"type": "subscribe"|"unsubscribe", "game_id": ..., "addresses": [...]}
+    static FString MakeSubscriptionMessage(const FString& InGameId, bool bSubscribe, const TArray<FString>& Addresses);
+
+    // Called by UInterverseConnectionSubsystem on the game thread
+    void HandleSharedConnectionState(bool bConnected);
+
     // Events
     UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
     FOnWebSocketConnected OnWebSocketConnected;
@@ -83,16 +325,177 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
     FOnTransferComplete OnTransferComplete;
 
+    // An optimistic transfer was rejected; the asset is back with FromAddress, gameplay should undo the move
+    UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
+    FOnTransferRolledBack OnTransferRolledBack;
+
+    // Carries no address: with bCoalesceEvents it only fires for a frame that updated a single wallet
     UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
     FOnBalanceUpdated OnBalanceUpdated;
 
+    // Every balance update with its wallet, also for coalesced updates of several wallets
+    UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
+    FOnAddressBalanceUpdated OnAddressBalanceUpdated;
+
+    UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
+    FOnBalancesReceived OnBalancesReceived;
+
+    // Coalesced asset events of one tick, latest version of each asset only (bCoalesceEvents)
+    UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
+    FOnAssetsUpdated OnAssetsUpdated;
+
+    UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
+    FOnPlayerAssetsReceived OnPlayerAssetsReceived;
+
+    // Fired once per item of a batch mint; ItemIndex refers to the submitted array
+    UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
+    FOnBatchMintItemResult OnBatchMintItemResult;
+
+    // Fired once after every chunk of a batch mint has completed
+    UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
+    FOnBatchMintComplete OnBatchMintComplete;
+
+    // Fired when every step of a WarmUp has finished, also if some of them failed
+    UPROPERTY(BlueprintAssignable, Category = "Interverse|Events")
+    FOnInterverseReady OnReady;
+
 private:
     // Implementation details
     TSharedPtr<IWebSocket> WebSocket;
     FHttpModule* Http;
+
+    // Dedicated socket only; a shared connection reconnects itself
+    void OpenDedicatedSocket();
+    void CloseDedicatedSocket();
+    void HandleDedicatedSocketLost();
+    void SendOnDedicatedSocket(const FString& Message);
+    FInterverseReconnector Reconnector;
+    TSharedPtr<FInterverseSocketSession, ESPMode::ThreadSafe> SocketSession;
+    TSharedPtr<FInterverseSocketTraffic, ESPMode::ThreadSafe> SocketTraffic;
+    // When the last handshake went out, 0 once its welcome arrived
+    double HandshakeSentTime = 0.0;
+    // Between Connect and its connected or error callback
+    bool bDedicatedSocketConnecting = false;
+
+    TSharedRef<FInterverseTelemetry> Telemetry = MakeShared<FInterverseTelemetry>();
     
-    void OnHttpResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess);
     void ProcessWebSocketMessage(const FString& Message);
     FString GetEndpointPath(const FString& Endpoint);
-    TSharedPtr<FJsonObject> ConvertPropertiesToJson(const FInterverseBaseProperties& Properties);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateApiRequest(const FString& Verb, const FString& Endpoint);
+    void SubmitRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, EInterverseRequestPriority Priority);
+    UInterverseConnectionSubsystem* GetConnectionSubsystem() const;
+    bool bSubscribedToSharedConnection = false;
+    // Connection the subsystem registered this component on, kept so later config changes cannot orphan it
+    FString SharedConnectionKey;
+    friend class UInterverseConnectionSubsystem;
+
+    // Broadcasts OnWebSocketConnected and answers WhenWebSocketConnected
+    void NotifyWebSocketConnected(bool bConnected);
+    // Runs OnConnected right away if the socket is connected or no attempt can follow, else after the pending attempt
+    void WhenWebSocketConnected(TFunction<void(bool bConnected)> OnConnected);
+    TArray<TFunction<void(bool bConnected)>> WebSocketConnectWaiters;
+
+    // Every request ends in exactly one call of its continuation, also when the component is gone
+    template <typename ResultType>
+    using TResultCallback = TFunction<void(const ResultType&)>;
+    // Cancels the queued and in-flight requests and answers every continuation still held by the component
+    void FailPendingRequests();
+
+    void RequestWallet(TResultCallback<FInterverseWalletResult> OnComplete);
+    void RequestBalance(const FString& Address, TResultCallback<FInterverseBalanceResult> OnComplete);
+    void RequestBalances(const TArray<FString>& Addresses, TResultCallback<FInterverseBalancesResult> OnComplete);
+    void RequestMint(const FString& OwnerAddress, const FInterverseBaseProperties& Properties,
+                     const TMap<FString, FString>& CustomProperties, TResultCallback<FInterverseMintResult> OnComplete);
+    void RequestTransfer(const FString& AssetId, const FString& FromAddress, const FString& ToAddress,
+                         TResultCallback<FInterverseTransferResult> OnComplete);
+    void RequestPlayerAssets(const FString& PlayerAddress, TResultCallback<FInterversePlayerAssetsResult> OnComplete);
+    void SendPlayerAssetsRequest(const FString& PlayerAddress);
+    void RequestWarmUp(const FString& PlayerAddress, TResultCallback<FInterverseWarmUpResult> OnComplete);
+    void RequestGameVerification(TFunction<void(bool bVerified, const FString& Error)> OnComplete);
+
+    // ServerTime is the node's clock when the page was read, unset if it sent none
+    using FAssetPageCallback = TFunction<void(const FInterverseAssetPageResult&, const FDateTime& ServerTime)>;
+    void RequestAssetPage(const FString& PlayerAddress, const FString& Cursor, int32 PageSize,
+                          EInterverseRequestPriority Priority, FAssetPageCallback OnComplete);
+    // Cold paged fetch into the asset cache; SyncTime is the high-water mark recorded once the last page is in
+    void StreamAssetPages(const FString& PlayerAddress, const FString& Cursor, int32 PageSize, int32 PageIndex,
+                          const FDateTime& SyncTime, TResultCallback<FInterverseAssetPageResult> OnPage);
+
+    // Returns RequestBodyBuffer, valid until the next request body is written
+    const FString& MakeMintBody(const FString& OwnerAddress, const FInterverseBaseProperties& Properties,
+                                const TMap<FString, FString>& CustomProperties);
+    // Reused for every JSON request body so writing one allocates only when it outgrows the largest so far
+    FString RequestBodyBuffer;
+    static FInterverseMintResult ParseMintResponse(FHttpResponsePtr Response, bool bSuccess);
+    static FInterverseTransferResult ParseTransferResponse(FHttpResponsePtr Response, bool bSuccess, const FString& AssetId,
+                                                           const FString& FromAddress, const FString& ToAddress);
+    void ApplyMintResult(const FInterverseMintResult& Result);
+    void ApplyTransferResult(const FInterverseTransferResult& Result);
+
+    // Confirms or rolls back a pending optimistic transfer, or moves the cached asset if none was pending
+    void SettleTransfer(const FString& AssetId, const FString& FromAddress, const FString& ToAddress,
+                        bool bSuccess, const FString& Error);
+
+    // Outbox (bUseOutbox): one batch in flight at a time, retried with backoff while the node is unreachable
+    void FlushOutbox();
+    static bool IsRetryableFailure(FHttpResponsePtr Response, bool bSuccess);
+    FInterverseOutbox Outbox;
+    FInterverseReconnector OutboxRetry { TEXT("Outbox flush") };
+    bool bOutboxFlushInFlight = false;
+    TMap<FGuid, TResultCallback<FInterverseMintResult>> OutboxMintCallbacks;
+    TMap<FGuid, TResultCallback<FInterverseTransferResult>> OutboxTransferCallbacks;
+
+    FInterverseBalanceResult HandleBalanceResponse(FHttpResponsePtr Response, bool bSuccess, const FString& Address);
+    // Set once the node answered a bulk balance request with 404; GetBalances then reads each address on its own
+    bool bBulkBalancesUnsupported = false;
+    // Asset list response as parsed by a worker of WorkPipeline
+    struct FAssetListResponse
+    {
+        bool bSuccess = false;
+        FString Error;
+        TArray<FInterverseAsset> Assets;
+        TArray<FString> RemovedAssetIds;
+        // The node's clock if it sent one, else the newest ModifiedAt
+        FDateTime SyncTime;
+    };
+    static FAssetListResponse ParsePlayerAssetsResponse(FHttpResponsePtr Response, bool bSuccess, const FString& PlayerAddress);
+    // Returns false if the cache was invalidated during a delta sync and the request has to be repeated
+    bool ApplyPlayerAssetsResponse(FAssetListResponse&& Response, const FString& PlayerAddress,
+                                   bool bDeltaSync, FInterversePlayerAssetsResult& OutResult);
+
+    // Reads "data" of a {"success": true, "data": {...}} response, or describes why there is none
+    static bool ParseApiResponse(FHttpResponsePtr Response, bool bSuccess, TSharedPtr<FJsonObject>& OutData, FString& OutError);
+
+    // Single-flight bookkeeping for reads, keyed like "balance:<address>"
+    bool IsReadFresh(const FString& Key) const;
+    void MarkReadFresh(const FString& Key);
+    TMap<FString, TArray<TResultCallback<FInterverseBalanceResult>>> BalanceWaiters;
+    TMap<FString, TArray<TResultCallback<FInterversePlayerAssetsResult>>> PlayerAssetsWaiters;
+    TMap<FString, double> ReadFreshUntil;
+    TMap<FString, float> CachedBalances;
+
+    FInterverseAssetCache AssetCache;
+    TSharedPtr<FInterverseRequestScheduler> RequestScheduler;
+    TSharedRef<FInterverseWorkPipeline, ESPMode::ThreadSafe> WorkPipeline = MakeShared<FInterverseWorkPipeline, ESPMode::ThreadSafe>();
+
+    void DrainSocketEvents();
+    void DispatchSocketEvent(const FInterverseSocketEvent& Event);
+    void DispatchAssetUpdate(const FInterverseAsset& Asset);
+    // Merges an asset delta into the cached version, fetching the owner's assets if there is none
+    void DispatchAssetDelta(const FInterverseSocketEvent& Event);
+    void FlushCoalescedEvents();
+
+    // High priority transfers overtake asset events queued before them. An asset event with a lower
+    // sequence than the transfer already dispatched for the asset would restore the previous owner.
+    bool IsSupersededByTransfer(const FInterverseSocketEvent& Event) const;
+    TMap<FString, int64> TransferSequences;
+
+    TSharedPtr<FInterverseSocketEventQueue, ESPMode::ThreadSafe> SocketEvents;
+    // Dedicated socket only; the shared connection has its own
+    TSharedPtr<FInterverseSocketInbox, ESPMode::ThreadSafe> SocketInbox;
+
+    // Pending coalesced events, flushed at the end of each drain
+    TMap<FString, float> CoalescedBalances;
+    TArray<FInterverseAsset> CoalescedAssets;
+    TMap<FString, int32> CoalescedAssetIndex;
 };
\ No newline at end of file
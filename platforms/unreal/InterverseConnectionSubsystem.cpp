@@ -0,0 +1,471 @@
+#include "InterverseConnectionSubsystem.h"
+#include "InterverseSDKComponent.h"
+#include "WebSocketsModule.h"
+#include "IWebSocket.h"
+#include "Async/Async.h"
+#include "InterverseTelemetry.h"
+
+FInterverseSharedConnection::FInterverseSharedConnection(const FString& InUrl, const FInterverseSocketOptions& InOptions,
+                                                         const FInterverseReconnectSettings& InReconnectSettings)
+    : Url(InUrl)
+    , Options(InOptions)
+    , Session(MakeShared<FInterverseSocketSession, ESPMode::ThreadSafe>())
+    , Traffic(MakeShared<FInterverseSocketTraffic, ESPMode::ThreadSafe>())
+    , EventPool(MakeShared<FInterverseSocketEventPool, ESPMode::ThreadSafe>())
+{
+    Reconnector.Configure(InReconnectSettings);
+}
+
+void FInterverseSharedConnection::Connect()
+{
+    UE_LOG(LogTemp, Log, TEXT("Opening shared WebSocket connection: %s"), *Url);
+
+    CloseSocket();
+
+    WebSocket = FWebSocketsModule::Get().CreateWebSocket(Url);
+
+    TWeakPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> WeakThis = AsShared();
+
+    WebSocket->OnConnected().AddLambda([WeakThis]() {
+        AsyncTask(ENamedThreads::GameThread, [WeakThis]() {
+            if (TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> This = WeakThis.Pin())
+            {
+                TArray<FString> GameIds;
+                {
+                    FScopeLock Lock(&This->SubscribersLock);
+                    for (const FSubscriber& Subscriber : This->Subscribers)
+                    {
+                        GameIds.AddUnique(Subscriber.GameId);
+                    }
+                }
+                This->bConnecting = false;
+                This->Reconnector.ResetAttempts();
+                for (const FString& GameId : GameIds)
+                {
+                    This->SendHandshake(GameId);
+                }
+                This->BroadcastConnectionState(true);
+            }
+        });
+    });
+
+    WebSocket->OnConnectionError().AddLambda([WeakThis](const FString& Error) {
+        UE_LOG(LogTemp, Error, TEXT("Shared WebSocket Connection Error: %s"), *Error);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis]() {
+            if (TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> This = WeakThis.Pin())
+            {
+                // Reconnect first so the components see whether another attempt follows
+                This->bConnecting = false;
+                This->HandleConnectionLost();
+                This->BroadcastConnectionState(false);
+            }
+        });
+    });
+
+    if (!Inbox.IsValid())
+    {
+        Inbox = MakeShared<FInterverseSocketInbox, ESPMode::ThreadSafe>(FInterverseSocketInbox::DefaultCapacity, Traffic, EventPool,
+            [WeakThis](FInterverseSocketEvent&& Event) {
+                if (TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> This = WeakThis.Pin())
+                {
+                    const int64 Sequence = Event.Sequence;
+                    const FString ResumeToken = Event.ResumeToken;
+                    if (This->Route(MoveTemp(Event)))
+                    {
+                        This->Session->Observe(Sequence, ResumeToken);
+                    }
+                    else
+                    {
+                        This->Session->Hold(Sequence);
+                    }
+                }
+            });
+    }
+    Inbox->Bind(WebSocket, Options.bBinaryFrames || Options.bCompressFrames);
+
+    WebSocket->OnClosed().AddLambda([WeakThis](int32 StatusCode, const FString& Reason, bool bWasClean) {
+        UE_LOG(LogTemp, Warning, TEXT("Shared WebSocket Closed: Status Code: %d, Reason: %s, Clean: %s"),
+            StatusCode, *Reason, bWasClean ? TEXT("Yes") : TEXT("No"));
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis]() {
+            if (TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> This = WeakThis.Pin())
+            {
+                This->HandshakenGames.Reset();
+                This->HandleConnectionLost();
+                This->BroadcastConnectionState(false);
+            }
+        });
+    });
+
+    bConnecting = true;
+    WebSocket->Connect();
+}
+
+void FInterverseSharedConnection::Close()
+{
+    Reconnector.Cancel();
+    CloseSocket();
+}
+
+void FInterverseSharedConnection::HandleConnectionLost()
+{
+    TWeakPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> WeakThis = AsShared();
+    const bool bScheduled = Reconnector.Schedule([WeakThis]() {
+        if (TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> This = WeakThis.Pin())
+        {
+            This->Connect();
+        }
+    });
+    if (bScheduled)
+    {
+        INC_DWORD_STAT(STAT_InterverseReconnects);
+    }
+}
+
+void FInterverseSharedConnection::CloseSocket()
+{
+    // Handlers are unbound first so our own close is not taken for a lost connection
+    if (WebSocket.IsValid())
+    {
+        WebSocket->OnConnected().Clear();
+        WebSocket->OnConnectionError().Clear();
+        WebSocket->OnMessage().Clear();
+        WebSocket->OnRawMessage().Clear();
+        WebSocket->OnClosed().Clear();
+        WebSocket->Close();
+        WebSocket.Reset();
+    }
+    HandshakenGames.Reset();
+    bConnecting = false;
+}
+
+bool FInterverseSharedConnection::IsConnected() const
+{
+    return WebSocket.IsValid() && WebSocket->IsConnected();
+}
+
+void FInterverseSharedConnection::Send(const FString& Message)
+{
+    if (IsConnected())
+    {
+        Traffic->AddSent(FTCHARToUTF8(*Message).Length());
+        WebSocket->Send(Message);
+    }
+}
+
+void FInterverseSharedConnection::AddSubscriber(FSubscriber&& Subscriber)
+{
+    const FString GameId = Subscriber.GameId;
+    TWeakObjectPtr<UInterverseSDKComponent> Component = Subscriber.Component;
+    Subscriber.Queue->SetEventPool(EventPool);
+    {
+        FScopeLock Lock(&SubscribersLock);
+        Subscribers.Add(MoveTemp(Subscriber));
+    }
+
+    // Late subscribers on an already open socket still need their game registered and a connected event
+    if (IsConnected())
+    {
+        SendHandshake(GameId);
+        SyncSubscriptions(GameId);
+        if (UInterverseSDKComponent* Target = Component.Get())
+        {
+            Target->HandleSharedConnectionState(true);
+        }
+    }
+}
+
+void FInterverseSharedConnection::SetSubscriberAddresses(const UInterverseSDKComponent* Component, const TArray<FString>& Addresses)
+{
+    TArray<FString> GameIds;
+    {
+        FScopeLock Lock(&SubscribersLock);
+        for (FSubscriber& Subscriber : Subscribers)
+        {
+            if (Subscriber.Component.Get() == Component)
+            {
+                Subscriber.Addresses = TSet<FString>(Addresses);
+                GameIds.AddUnique(Subscriber.GameId);
+            }
+        }
+    }
+
+    for (const FString& GameId : GameIds)
+    {
+        SyncSubscriptions(GameId);
+    }
+}
+
+void FInterverseSharedConnection::RemoveSubscriber(const UInterverseSDKComponent* Component)
+{
+    TArray<FString> GameIds;
+    {
+        FScopeLock Lock(&SubscribersLock);
+        Subscribers.RemoveAll([Component, &GameIds](const FSubscriber& Subscriber) {
+            const bool bRemove = !Subscriber.Component.IsValid() || Subscriber.Component.Get() == Component;
+            if (bRemove)
+            {
+                GameIds.AddUnique(Subscriber.GameId);
+            }
+            return bRemove;
+        });
+    }
+
+    for (const FString& GameId : GameIds)
+    {
+        SyncSubscriptions(GameId);
+    }
+}
+
+int32 FInterverseSharedConnection::NumSubscribers() const
+{
+    FScopeLock Lock(&SubscribersLock);
+    return Subscribers.Num();
+}
+
+bool FInterverseSharedConnection::Route(FInterverseSocketEvent&& Event)
+{
+    TArray<TSharedPtr<FInterverseSocketEventQueue, ESPMode::ThreadSafe>> Targets;
+    {
+        FScopeLock Lock(&SubscribersLock);
+        for (const FSubscriber& Subscriber : Subscribers)
+        {
+            if (Matches(Subscriber, Event))
+            {
+                Targets.Add(Subscriber.Queue);
+            }
+        }
+    }
+
+    // An event no subscriber wants is observed as well, otherwise it would hold the resume point back
+    bool bAllQueued = true;
+    for (int32 Index = 0; Index < Targets.Num(); ++Index)
+    {
+        const bool bLast = Index == Targets.Num() - 1;
+        if (!Targets[Index]->Enqueue(bLast ? MoveTemp(Event) : FInterverseSocketEvent(Event)))
+        {
+            bAllQueued = false;
+            UE_LOG(LogTemp, Warning, TEXT("WebSocket event queue full (%d), dropping message"), Targets[Index]->GetCapacity());
+        }
+    }
+    return bAllQueued;
+}
+
+bool FInterverseSharedConnection::Matches(const FSubscriber& Subscriber, const FInterverseSocketEvent& Event)
+{
+    if (!Event.Asset.GameId.IsEmpty() && Event.Asset.GameId != Subscriber.GameId)
+    {
+        return false;
+    }
+
+    if (Subscriber.Addresses.Num() == 0 || Event.Address.IsEmpty())
+    {
+        return true;
+    }
+
+    return Subscriber.Addresses.Contains(Event.Address)
+        || Subscriber.Addresses.Contains(Event.Transaction.SenderAddress);
+}
+
+void FInterverseSharedConnection::BroadcastConnectionState(bool bConnected)
+{
+    TArray<TWeakObjectPtr<UInterverseSDKComponent>> Components;
+    {
+        FScopeLock Lock(&SubscribersLock);
+        for (const FSubscriber& Subscriber : Subscribers)
+        {
+            Components.Add(Subscriber.Component);
+        }
+    }
+
+    for (const TWeakObjectPtr<UInterverseSDKComponent>& Component : Components)
+    {
+        if (UInterverseSDKComponent* Target = Component.Get())
+        {
+            Target->HandleSharedConnectionState(bConnected);
+        }
+    }
+}
+
+void FInterverseSharedConnection::SendHandshake(const FString& GameId)
+{
+    if (!IsConnected() || HandshakenGames.Contains(GameId))
+    {
+        return;
+    }
+
+    TSet<FString> Addresses;
+    GetGameAddresses(GameId, Addresses);
+    HandshakenGames.Add(GameId, Addresses);
+    Send(UInterverseSDKComponent::MakeHandshakeMessage(GameId, Options, Addresses.Array(), &Session.Get()));
+}
+
+bool FInterverseSharedConnection::GetGameAddresses(const FString& GameId, TSet<FString>& OutAddresses) const
+{
+    OutAddresses.Reset();
+
+    bool bHasSubscribers = false;
+    FScopeLock Lock(&SubscribersLock);
+    for (const FSubscriber& Subscriber : Subscribers)
+    {
+        if (Subscriber.GameId != GameId)
+        {
+            continue;
+        }
+
+        if (Subscriber.Addresses.Num() == 0)
+        {
+            OutAddresses.Reset();
+            return true;
+        }
+
+        bHasSubscribers = true;
+        OutAddresses.Append(Subscriber.Addresses);
+    }
+    return bHasSubscribers;
+}
+
+void FInterverseSharedConnection::SyncSubscriptions(const FString& GameId)
+{
+    // Games not registered yet get their filter with the handshake
+    TSet<FString>* Current = HandshakenGames.Find(GameId);
+    TSet<FString> Wanted;
+    if (!Current || !IsConnected() || !GetGameAddresses(GameId, Wanted))
+    {
+        return;
+    }
+
+    // Subscribing first means the filter never becomes empty, i.e. unfiltered, in between
+    const TArray<FString> Added = Wanted.Difference(*Current).Array();
+    const TArray<FString> Removed = Current->Difference(Wanted).Array();
+    if (Added.Num() > 0)
+    {
+        Send(UInterverseSDKComponent::MakeSubscriptionMessage(GameId, true, Added));
+    }
+    if (Removed.Num() > 0)
+    {
+        Send(UInterverseSDKComponent::MakeSubscriptionMessage(GameId, false, Removed));
+    }
+    *Current = MoveTemp(Wanted);
+}
+
+void UInterverseConnectionSubsystem::Deinitialize()
+{
+    for (TPair<FString, TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe>>& Pair : Connections)
+    {
+        Pair.Value->Close();
+    }
+    Connections.Reset();
+
+    Super::Deinitialize();
+}
+
+void UInterverseConnectionSubsystem::Subscribe(UInterverseSDKComponent* Component,
+                                               const TSharedPtr<FInterverseSocketEventQueue, ESPMode::ThreadSafe>& Queue,
+                                               const TArray<FString>& Addresses)
+{
+    check(Component && Queue.IsValid());
+
+    // Settings changed since the last Subscribe can mean another socket; leave the old one first
+    const FString Key = MakeConnectionKey(Component);
+    if (!Component->SharedConnectionKey.IsEmpty() && Component->SharedConnectionKey != Key)
+    {
+        Unsubscribe(Component);
+    }
+    Component->SharedConnectionKey = Key;
+
+    TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe>& Connection = Connections.FindOrAdd(Key);
+    const bool bNewConnection = !Connection.IsValid();
+    if (bNewConnection)
+    {
+        Connection = MakeShared<FInterverseSharedConnection, ESPMode::ThreadSafe>(
+            UInterverseSDKComponent::MakeWebSocketUrl(Component->NodeUrl, Component->ApiKey),
+            Component->GetSocketOptions(), Component->ReconnectSettings);
+    }
+
+    // Re-subscribing replaces the previous registration, e.g. after a config change
+    Connection->RemoveSubscriber(Component);
+
+    FInterverseSharedConnection::FSubscriber Subscriber;
+    Subscriber.Component = Component;
+    Subscriber.Queue = Queue;
+    Subscriber.GameId = Component->GameId;
+    Subscriber.Addresses = TSet<FString>(Addresses);
+    Connection->AddSubscriber(MoveTemp(Subscriber));
+
+    if (bNewConnection)
+    {
+        Connection->Connect();
+    }
+}
+
+void UInterverseConnectionSubsystem::UpdateAddresses(UInterverseSDKComponent* Component, const TArray<FString>& Addresses)
+{
+    if (TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> Connection = FindConnection(Component))
+    {
+        Connection->SetSubscriberAddresses(Component, Addresses);
+    }
+}
+
+void UInterverseConnectionSubsystem::Unsubscribe(UInterverseSDKComponent* Component)
+{
+    const FString Key = MoveTemp(Component->SharedConnectionKey);
+    Component->SharedConnectionKey.Reset();
+    if (TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe>* Connection = Connections.Find(Key))
+    {
+        (*Connection)->RemoveSubscriber(Component);
+        if ((*Connection)->NumSubscribers() == 0)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Closing shared WebSocket connection, no subscribers left"));
+            (*Connection)->Close();
+            Connections.Remove(Key);
+        }
+    }
+}
+
+bool UInterverseConnectionSubsystem::IsConnected(const UInterverseSDKComponent* Component) const
+{
+    TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> Connection = FindConnection(Component);
+    return Connection.IsValid() && Connection->IsConnected();
+}
+
+bool UInterverseConnectionSubsystem::IsConnecting(const UInterverseSDKComponent* Component) const
+{
+    TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> Connection = FindConnection(Component);
+    return Connection.IsValid() && Connection->IsConnecting();
+}
+
+void UInterverseConnectionSubsystem::Send(const UInterverseSDKComponent* Component, const FString& Message)
+{
+    if (TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> Connection = FindConnection(Component))
+    {
+        Connection->Send(Message);
+    }
+}
+
+FInterverseSocketTrafficStats UInterverseConnectionSubsystem::GetTrafficStats(const UInterverseSDKComponent* Component) const
+{
+    TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> Connection = FindConnection(Component);
+    return Connection.IsValid() ? Connection->GetTrafficStats() : FInterverseSocketTrafficStats();
+}
+
+int32 UInterverseConnectionSubsystem::GetReconnectCount(const UInterverseSDKComponent* Component) const
+{
+    TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> Connection = FindConnection(Component);
+    return Connection.IsValid() ? Connection->GetReconnectCount() : 0;
+}
+
+FString UInterverseConnectionSubsystem::MakeConnectionKey(const UInterverseSDKComponent* Component)
+{
+    // Frame encoding and deltas are negotiated per socket, so components that differ in them cannot share one
+    const FInterverseSocketOptions Options = Component->GetSocketOptions();
+    return FString::Printf(TEXT("%s|%s|%d%d%d"), *Component->NodeUrl, *Component->ApiKey,
+        Options.bBinaryFrames, Options.bCompressFrames, Options.bAssetDeltas);
+}
+
+TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> UInterverseConnectionSubsystem::FindConnection(const UInterverseSDKComponent* Component) const
+{
+    const TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe>* Connection = Connections.Find(Component->SharedConnectionKey);
+    return Connection ? *Connection : nullptr;
+}
@@ -0,0 +1,115 @@
+// platforms/unreal/InterverseConnectionSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "InterverseSocketEvents.h"
+#include "InterverseReconnect.h"
+#include "InterverseConnectionSubsystem.generated.h"
+
+class IWebSocket;
+class UInterverseSDKComponent;
+
+// One WebSocket shared by every component that uses the same NodeUrl/ApiKey
+class INTERVERSESDK_API FInterverseSharedConnection : public TSharedFromThis<FInterverseSharedConnection, ESPMode::ThreadSafe>
+{
+public:
+    struct FSubscriber
+    {
+        TWeakObjectPtr<UInterverseSDKComponent> Component;
+        TSharedPtr<FInterverseSocketEventQueue, ESPMode::ThreadSafe> Queue;
+        FString GameId;
+        TSet<FString> Addresses;  // Empty means every event for GameId
+    };
+
+    FInterverseSharedConnection(const FString& InUrl, const FInterverseSocketOptions& InOptions,
+                                const FInterverseReconnectSettings& InReconnectSettings);
+
+    void Connect();
+    void Close();
+    bool IsConnected() const;
+    // A connect is in progress or a reconnect is scheduled; false once the attempts gave up
+    bool IsConnecting() const { return bConnecting || Reconnector.IsScheduled(); }
+    void Send(const FString& Message);
+
+    void AddSubscriber(FSubscriber&& Subscriber);
+    void SetSubscriberAddresses(const UInterverseSDKComponent* Component, const TArray<FString>& Addresses);
+    void RemoveSubscriber(const UInterverseSDKComponent* Component);
+    int32 NumSubscribers() const;
+    FInterverseSocketTrafficStats GetTrafficStats() const { return Traffic->GetStats(); }
+    int32 GetReconnectCount() const { return Reconnector.GetTotalAttempts(); }
+
+private:
+    // Inbox worker: hands a decoded event to every matching subscriber queue, false if any of them dropped it
+    bool Route(FInterverseSocketEvent&& Event);
+    void BroadcastConnectionState(bool bConnected);
+    void SendHandshake(const FString& GameId);
+
+    // Addresses the node should filter GameId's events by: the union of its subscribers' addresses,
+    // or none (every event) as soon as one subscriber wants all of them. False if GameId has no subscribers.
+    bool GetGameAddresses(const FString& GameId, TSet<FString>& OutAddresses) const;
+    // Sends the subscribe/unsubscribe messages that bring the node's filter for GameId up to date
+    void SyncSubscriptions(const FString& GameId);
+    void HandleConnectionLost();
+    void CloseSocket();
+
+    static bool Matches(const FSubscriber& Subscriber, const FInterverseSocketEvent& Event);
+
+    FString Url;
+    FInterverseSocketOptions Options;
+    TSharedPtr<IWebSocket> WebSocket;
+
+    mutable FCriticalSection SubscribersLock;
+    TArray<FSubscriber> Subscribers;
+
+    // Shared by all games on the socket and kept across reconnects
+    TSharedRef<FInterverseSocketSession, ESPMode::ThreadSafe> Session;
+    TSharedRef<FInterverseSocketTraffic, ESPMode::ThreadSafe> Traffic;
+    // Created on the first Connect and reused by every socket after it
+    TSharedPtr<FInterverseSocketInbox, ESPMode::ThreadSafe> Inbox;
+    // Subscribers hand dispatched events back here for the inbox to decode into
+    TSharedRef<FInterverseSocketEventPool, ESPMode::ThreadSafe> EventPool;
+
+    // Game thread only; address filter the node currently applies to each game registered on this socket
+    TMap<FString, TSet<FString>> HandshakenGames;
+    FInterverseReconnector Reconnector;
+    // Game thread only; between Connect and its connected or error callback
+    bool bConnecting = false;
+};
+
+UCLASS()
+class INTERVERSESDK_API UInterverseConnectionSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // Registers the component on the shared socket for its NodeUrl/ApiKey and socket options, connecting it if needed
+    void Subscribe(UInterverseSDKComponent* Component,
+                   const TSharedPtr<FInterverseSocketEventQueue, ESPMode::ThreadSafe>& Queue,
+                   const TArray<FString>& Addresses);
+
+    // Replaces the address filter of an already subscribed component
+    void UpdateAddresses(UInterverseSDKComponent* Component, const TArray<FString>& Addresses);
+
+    // Removes the component and closes the socket once nobody uses it anymore
+    void Unsubscribe(UInterverseSDKComponent* Component);
+
+    bool IsConnected(const UInterverseSDKComponent* Component) const;
+    // Whether the component's socket will still report a connection attempt
+    bool IsConnecting(const UInterverseSDKComponent* Component) const;
+    void Send(const UInterverseSDKComponent* Component, const FString& Message);
+    FInterverseSocketTrafficStats GetTrafficStats(const UInterverseSDKComponent* Component) const;
+    int32 GetReconnectCount(const UInterverseSDKComponent* Component) const;
+
+    UFUNCTION(BlueprintPure, Category = "Interverse|Network")
+    int32 GetOpenConnectionCount() const { return Connections.Num(); }
+
+private:
+    static FString MakeConnectionKey(const UInterverseSDKComponent* Component);
+
+    TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe> FindConnection(const UInterverseSDKComponent* Component) const;
+
+    TMap<FString, TSharedPtr<FInterverseSharedConnection, ESPMode::ThreadSafe>> Connections;
+};
@@ -0,0 +1,221 @@
+#include "InterverseOutbox.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    constexpr int32 CompactAfterAcks = 256;
+
+    // Writes and syncs Path; SaveStringToFile leaves the data in the OS cache, where a power loss can drop it
+    bool SaveFileDurably(IPlatformFile& PlatformFile, const FString& Path, const FString& Contents)
+    {
+        TUniquePtr<IFileHandle> File(PlatformFile.OpenWrite(*Path));
+        if (!File.IsValid())
+        {
+            return false;
+        }
+        const FTCHARToUTF8 Utf8(*Contents);
+        return File->Write(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()) && File->Flush(true);
+    }
+
+    const TCHAR* OpToString(EInterverseOutboxOp Op)
+    {
+        return Op == EInterverseOutboxOp::Transfer ? TEXT("transfer") : TEXT("mint");
+    }
+
+    FString ToJsonLine(const TSharedRef<FJsonObject>& Object)
+    {
+        FString Line;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+            TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+        FJsonSerializer::Serialize(Object, Writer);
+        return Line + TEXT("\n");
+    }
+
+    FString MakeAddLine(const FInterverseOutbox::FEntry& Entry)
+    {
+        TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+        Object->SetStringField(TEXT("add"), Entry.Key.ToString(EGuidFormats::DigitsWithHyphens));
+        Object->SetStringField(TEXT("op"), OpToString(Entry.Op));
+        Object->SetStringField(TEXT("body"), Entry.Body);
+        Object->SetStringField(TEXT("created_at"), Entry.CreatedAt.ToIso8601());
+        return ToJsonLine(Object);
+    }
+}
+
+FInterverseOutbox::~FInterverseOutbox()
+{
+    Close();
+}
+
+void FInterverseOutbox::Open(const FString& InJournalPath)
+{
+    Close();
+    JournalPath = InJournalPath;
+
+    // A side file next to a journal is an interrupted compaction that may be incomplete; without the journal
+    // the crash came after the side file was complete, while the journal was being replaced
+    IFileManager& FileManager = IFileManager::Get();
+    const FString TempPath = JournalPath + TEXT(".tmp");
+    if (FileManager.FileExists(*TempPath))
+    {
+        if (FileManager.FileExists(*JournalPath))
+        {
+            FileManager.Delete(*TempPath);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Recovering outbox journal %s from an interrupted compaction"), *JournalPath);
+            FileManager.Move(*JournalPath, *TempPath);
+        }
+    }
+
+    // Replay the journal; a torn last line from a crash is skipped
+    TArray<FString> Lines;
+    FFileHelper::LoadFileToStringArray(Lines, *JournalPath);
+    TArray<FEntry> Queued = MoveTemp(Entries);
+    Entries.Reset();
+    for (const FString& Line : Lines)
+    {
+        TSharedPtr<FJsonObject> Object;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+        if (!FJsonSerializer::Deserialize(Reader, Object) || !Object.IsValid())
+        {
+            continue;
+        }
+
+        FString KeyString;
+        FGuid Key;
+        if (Object->TryGetStringField(TEXT("ack"), KeyString) && FGuid::Parse(KeyString, Key))
+        {
+            Entries.RemoveAll([&Key](const FEntry& Entry) { return Entry.Key == Key; });
+        }
+        else if (Object->TryGetStringField(TEXT("add"), KeyString) && FGuid::Parse(KeyString, Key))
+        {
+            FEntry& Entry = Entries.AddDefaulted_GetRef();
+            Entry.Key = Key;
+            Entry.Op = Object->GetStringField(TEXT("op")) == TEXT("transfer") ? EInterverseOutboxOp::Transfer : EInterverseOutboxOp::Mint;
+            Object->TryGetStringField(TEXT("body"), Entry.Body);
+            FString CreatedAt;
+            if (Object->TryGetStringField(TEXT("created_at"), CreatedAt))
+            {
+                FDateTime::ParseIso8601(*CreatedAt, Entry.CreatedAt);
+            }
+        }
+    }
+
+    // Entries queued before Open are kept behind the recovered ones
+    Entries.Append(MoveTemp(Queued));
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*FPaths::GetPath(JournalPath));
+    Compact();
+
+    if (Entries.Num() > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Recovered %d unconfirmed operations from %s"), Entries.Num(), *JournalPath);
+    }
+}
+
+void FInterverseOutbox::Close()
+{
+    Journal.Reset();
+}
+
+FGuid FInterverseOutbox::Enqueue(EInterverseOutboxOp Op, const FString& Body)
+{
+    FEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.Key = FGuid::NewGuid();
+    Entry.Op = Op;
+    Entry.Body = Body;
+    Entry.CreatedAt = FDateTime::UtcNow();
+
+    Append(MakeAddLine(Entry));
+    return Entry.Key;
+}
+
+void FInterverseOutbox::Peek(int32 MaxEntries, TArray<FEntry>& OutEntries) const
+{
+    OutEntries.Reset();
+    const int32 Count = FMath::Min(MaxEntries, Entries.Num());
+    OutEntries.Append(Entries.GetData(), Count);
+}
+
+void FInterverseOutbox::Acknowledge(const FGuid& Key)
+{
+    if (Entries.RemoveAll([&Key](const FEntry& Entry) { return Entry.Key == Key; }) == 0)
+    {
+        return;
+    }
+
+    TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+    Object->SetStringField(TEXT("ack"), Key.ToString(EGuidFormats::DigitsWithHyphens));
+    Append(ToJsonLine(Object));
+
+    if (++AcksSinceCompaction >= CompactAfterAcks)
+    {
+        Compact();
+    }
+}
+
+const FInterverseOutbox::FEntry* FInterverseOutbox::Find(const FGuid& Key) const
+{
+    return Entries.FindByPredicate([&Key](const FEntry& Entry) { return Entry.Key == Key; });
+}
+
+const TCHAR* FInterverseOutbox::GetEndpoint(EInterverseOutboxOp Op)
+{
+    return Op == EInterverseOutboxOp::Transfer ? TEXT("assets/transfer") : TEXT("assets/mint");
+}
+
+void FInterverseOutbox::Append(const FString& Line)
+{
+    if (!Journal.IsValid())
+    {
+        return;
+    }
+
+    // Synced to disk before the request goes out; that is what makes this a write-ahead log
+    const FTCHARToUTF8 Utf8(*Line);
+    Journal->Write(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    Journal->Flush(true);
+}
+
+void FInterverseOutbox::Compact()
+{
+    if (JournalPath.IsEmpty())
+    {
+        return;
+    }
+
+    Journal.Reset();
+
+    // Write the open entries to a side file first so a crash never leaves a half-written journal
+    FString Contents;
+    for (const FEntry& Entry : Entries)
+    {
+        Contents += MakeAddLine(Entry);
+    }
+
+    const FString TempPath = JournalPath + TEXT(".tmp");
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    // Replaces the journal in one move once the side file is on disk; Open finishes the replacement if a
+    // platform does it in two steps
+    const bool bSaved = SaveFileDurably(PlatformFile, TempPath, Contents);
+    if (!bSaved || !IFileManager::Get().Move(*JournalPath, *TempPath, true))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to compact outbox journal %s"), *JournalPath);
+    }
+    AcksSinceCompaction = 0;
+
+    Journal.Reset(PlatformFile.OpenWrite(*JournalPath, true));
+    if (!Journal.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Cannot open outbox journal %s, operations will not survive a restart"), *JournalPath);
+    }
+}
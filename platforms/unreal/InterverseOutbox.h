@@ -0,0 +1,58 @@
+// platforms/unreal/InterverseOutbox.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+
+enum class EInterverseOutboxOp : uint8
+{
+    Mint,
+    Transfer
+};
+
+/**
+ * Write-ahead journal of mints and transfers that have not been confirmed by the node yet.
+ *
+ * Every operation is appended (and flushed) to the journal before it is sent and gets an
+ * idempotency key, so an operation that was sent but whose response was lost can be resent
+ * after a restart without being applied twice. Confirmed operations are appended as acks; the
+ * file is rewritten with only the open entries once enough acks have piled up. Game thread only.
+ */
+class INTERVERSESDK_API FInterverseOutbox
+{
+public:
+    struct FEntry
+    {
+        FGuid Key;
+        EInterverseOutboxOp Op = EInterverseOutboxOp::Mint;
+        FString Body;
+        FDateTime CreatedAt;
+    };
+
+    ~FInterverseOutbox();
+
+    // Opens the journal and recovers open entries. Without a call the outbox only lives in memory.
+    void Open(const FString& InJournalPath);
+    void Close();
+
+    FGuid Enqueue(EInterverseOutboxOp Op, const FString& Body);
+
+    // Oldest open entries first
+    void Peek(int32 MaxEntries, TArray<FEntry>& OutEntries) const;
+    void Acknowledge(const FGuid& Key);
+
+    const FEntry* Find(const FGuid& Key) const;
+    int32 Num() const { return Entries.Num(); }
+
+    static const TCHAR* GetEndpoint(EInterverseOutboxOp Op);
+
+private:
+    void Append(const FString& Line);
+    void Compact();
+
+    TArray<FEntry> Entries;
+    FString JournalPath;
+    TUniquePtr<IFileHandle> Journal;
+    int32 AcksSinceCompaction = 0;
+};
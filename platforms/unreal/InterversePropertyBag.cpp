@@ -0,0 +1,130 @@
+#include "InterversePropertyBag.h"
+#include "InterverseBinaryCodec.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+    // FString hashing and comparison in TMap ignore case
+    struct FCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+    {
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+    };
+
+    struct FKeyRegistry
+    {
+        FRWLock Lock;
+        TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> Ids;
+        TArray<FString> Keys;
+    };
+
+    FKeyRegistry& GetKeyRegistry()
+    {
+        static FKeyRegistry Registry;
+        return Registry;
+    }
+
+    FString ToString(FUtf8StringView View)
+    {
+        return FString(View.Len(), View.GetData());
+    }
+
+    const int32 TagsKey = FInterversePropertyKeys::Intern(TEXT("tags"));
+}
+
+int32 FInterversePropertyKeys::Intern(const FString& Key)
+{
+    FKeyRegistry& Registry = GetKeyRegistry();
+    {
+        FReadScopeLock ReadLock(Registry.Lock);
+        if (const int32* KeyId = Registry.Ids.Find(Key))
+        {
+            return *KeyId;
+        }
+    }
+
+    FWriteScopeLock WriteLock(Registry.Lock);
+    if (const int32* KeyId = Registry.Ids.Find(Key))
+    {
+        return *KeyId;
+    }
+    const int32 KeyId = Registry.Keys.Add(Key);
+    Registry.Ids.Add(Key, KeyId);
+    return KeyId;
+}
+
+int32 FInterversePropertyKeys::Find(const FString& Key)
+{
+    FKeyRegistry& Registry = GetKeyRegistry();
+    FReadScopeLock ReadLock(Registry.Lock);
+    const int32* KeyId = Registry.Ids.Find(Key);
+    return KeyId ? *KeyId : INDEX_NONE;
+}
+
+FString FInterversePropertyKeys::Get(int32 KeyId)
+{
+    FKeyRegistry& Registry = GetKeyRegistry();
+    FReadScopeLock ReadLock(Registry.Lock);
+    return Registry.Keys.IsValidIndex(KeyId) ? Registry.Keys[KeyId] : FString();
+}
+
+FInterverseCompactAsset FInterverseCompactAsset::FromAsset(const FInterverseAsset& Asset)
+{
+    FInterverseCompactAsset Compact;
+    Compact.AssetId = Asset.AssetId;
+    Compact.Owner = Asset.Owner;
+    Compact.OwnerGlobalID = Asset.OwnerGlobalID;
+    Compact.Category = Asset.Category;
+    Compact.Rarity = Asset.Rarity;
+    Compact.Metadata.FromMap(Asset.Metadata);
+    Compact.GameId = Asset.GameId;
+    Compact.CreatedAt = Asset.CreatedAt;
+    Compact.ModifiedAt = Asset.ModifiedAt;
+    Compact.bPendingTransfer = Asset.bPendingTransfer;
+    return Compact;
+}
+
+FInterverseCompactAsset FInterverseCompactAsset::FromView(const FInterverseAssetView& View)
+{
+    FInterverseCompactAsset Compact;
+    Compact.AssetId = ToString(View.AssetId);
+    Compact.Owner = ToString(View.Owner);
+    Compact.OwnerGlobalID = ToString(View.OwnerGlobalID);
+    Compact.Category = View.Category;
+    Compact.Rarity = View.Rarity;
+    Compact.Metadata.Reserve(View.Metadata.Num());
+    for (const TPair<FUtf8StringView, FUtf8StringView>& Pair : View.Metadata)
+    {
+        Compact.Metadata.Set(ToString(Pair.Key), ToString(Pair.Value));
+    }
+    Compact.GameId = ToString(View.GameId);
+    Compact.CreatedAt = View.CreatedAt;
+    Compact.ModifiedAt = View.ModifiedAt;
+    return Compact;
+}
+
+void FInterverseCompactAsset::ToAsset(FInterverseAsset& OutAsset) const
+{
+    OutAsset.AssetId = AssetId;
+    OutAsset.Owner = Owner;
+    OutAsset.OwnerGlobalID = OwnerGlobalID;
+    OutAsset.Category = Category;
+    OutAsset.Rarity = Rarity;
+    Metadata.ToMap(OutAsset.Metadata);
+    OutAsset.GameId = GameId;
+    OutAsset.CreatedAt = CreatedAt;
+    OutAsset.ModifiedAt = ModifiedAt;
+    OutAsset.bPendingTransfer = bPendingTransfer;
+}
+
+FInterverseAsset FInterverseCompactAsset::ToAsset() const
+{
+    FInterverseAsset Asset;
+    ToAsset(Asset);
+    return Asset;
+}
+
+const FString* FInterverseCompactAsset::FindTags() const
+{
+    return Metadata.FindById(TagsKey);
+}
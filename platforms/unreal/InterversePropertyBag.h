@@ -0,0 +1,158 @@
+// platforms/unreal/InterversePropertyBag.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/BinarySearch.h"
+#include "InterverseTypes.h"
+
+struct FInterverseAssetView;
+
+/**
+ * Process-wide registry of property and metadata keys.
+ *
+ * Every distinct key is stored once and bags refer to it by its index. Unlike FName and the FString
+ * keys of TMap, keys are compared case-sensitively, so "Damage" and "damage" stay two properties.
+ * Indices are never reused; any thread.
+ */
+class INTERVERSESDK_API FInterversePropertyKeys
+{
+public:
+    // Index of Key, registering it on first use
+    static int32 Intern(const FString& Key);
+
+    // Index of Key, or INDEX_NONE if it was never registered
+    static int32 Find(const FString& Key);
+
+    static FString Get(int32 KeyId);
+};
+
+/**
+ * Flat property bag keyed by registry indices.
+ *
+ * Entries live in one array sorted by key index, so small bags need no heap allocation beyond
+ * their values, keys such as "Damage" are stored once per process instead of once per item, and
+ * lookups are binary searches on integers instead of string hashes.
+ */
+template <typename ValueType, int32 InlineCount = 8>
+class TInterversePropertyBag
+{
+public:
+    using FEntry = TPair<int32, ValueType>;
+
+    const ValueType* Find(const FString& Key) const
+    {
+        const int32 KeyId = FInterversePropertyKeys::Find(Key);
+        return KeyId != INDEX_NONE ? FindById(KeyId) : nullptr;
+    }
+
+    const ValueType* FindById(int32 KeyId) const
+    {
+        const int32 Index = LowerBound(KeyId);
+        return Entries.IsValidIndex(Index) && Entries[Index].Key == KeyId ? &Entries[Index].Value : nullptr;
+    }
+
+    bool Contains(const FString& Key) const { return Find(Key) != nullptr; }
+
+    template <typename ArgType>
+    void Set(const FString& Key, ArgType&& Value)
+    {
+        SetById(FInterversePropertyKeys::Intern(Key), Forward<ArgType>(Value));
+    }
+
+    template <typename ArgType>
+    void SetById(int32 KeyId, ArgType&& Value)
+    {
+        const int32 Index = LowerBound(KeyId);
+        if (Entries.IsValidIndex(Index) && Entries[Index].Key == KeyId)
+        {
+            Entries[Index].Value = Forward<ArgType>(Value);
+        }
+        else
+        {
+            Entries.Insert(FEntry(KeyId, Forward<ArgType>(Value)), Index);
+        }
+    }
+
+    bool Remove(const FString& Key)
+    {
+        const int32 KeyId = FInterversePropertyKeys::Find(Key);
+        const int32 Index = KeyId != INDEX_NONE ? LowerBound(KeyId) : INDEX_NONE;
+        if (Entries.IsValidIndex(Index) && Entries[Index].Key == KeyId)
+        {
+            Entries.RemoveAt(Index, 1, false);
+            return true;
+        }
+        return false;
+    }
+
+    int32 Num() const { return Entries.Num(); }
+    void Reset() { Entries.Reset(); }
+    void Reserve(int32 Number) { Entries.Reserve(Number); }
+
+    auto begin() const { return Entries.begin(); }
+    auto end() const { return Entries.end(); }
+
+    // Blueprint-facing TMap conversions
+    void FromMap(const TMap<FString, ValueType>& Map)
+    {
+        Entries.Reset(Map.Num());
+        for (const TPair<FString, ValueType>& Pair : Map)
+        {
+            Entries.Add(FEntry(FInterversePropertyKeys::Intern(Pair.Key), Pair.Value));
+        }
+        Entries.Sort([](const FEntry& A, const FEntry& B) { return A.Key < B.Key; });
+    }
+
+    void ToMap(TMap<FString, ValueType>& OutMap) const
+    {
+        OutMap.Reset();
+        OutMap.Reserve(Entries.Num());
+        for (const FEntry& Entry : Entries)
+        {
+            OutMap.Add(FInterversePropertyKeys::Get(Entry.Key), Entry.Value);
+        }
+    }
+
+private:
+    int32 LowerBound(int32 KeyId) const
+    {
+        return Algo::LowerBound(Entries, KeyId, [](const FEntry& Entry, int32 Value) { return Entry.Key < Value; });
+    }
+
+    TArray<FEntry, TInlineAllocator<InlineCount>> Entries;
+};
+
+using FInterverseNumericPropertyBag = TInterversePropertyBag<float>;
+using FInterverseStringPropertyBag = TInterversePropertyBag<FString, 4>;
+
+/**
+ * Stored form of FInterverseAsset in FInterverseAssetCache.
+ *
+ * Metadata keeps its keys in the registry instead of a TMap of FStrings per asset, which is what
+ * dominates the memory of servers holding tens of thousands of items. Converted to FInterverseAsset,
+ * whose TMap UPROPERTYs Blueprint code uses, only when assets are handed out.
+ */
+struct INTERVERSESDK_API FInterverseCompactAsset
+{
+    FString AssetId;
+    FString Owner;
+    FString OwnerGlobalID;
+    EInterverseItemCategory Category = EInterverseItemCategory::Cosmetic;
+    EInterverseRarity Rarity = EInterverseRarity::Common;
+    FInterverseStringPropertyBag Metadata;
+    FString GameId;
+    FDateTime CreatedAt;
+    FDateTime ModifiedAt;
+    bool bPendingTransfer = false;
+
+    static FInterverseCompactAsset FromAsset(const FInterverseAsset& Asset);
+
+    // Reads the metadata keys straight from the record bytes, without a TMap in between
+    static FInterverseCompactAsset FromView(const FInterverseAssetView& View);
+
+    void ToAsset(FInterverseAsset& OutAsset) const;
+    FInterverseAsset ToAsset() const;
+
+    // The "tags" metadata entry, or nullptr
+    const FString* FindTags() const;
+};
@@ -0,0 +1,38 @@
+#include "InterverseReconnect.h"
+
+bool FInterverseReconnector::Schedule(TFunction<void()> Reconnect)
+{
+    if (Pending.IsValid())
+    {
+        return true;
+    }
+
+    if (!Settings.bEnabled || (Settings.MaxAttempts > 0 && Attempts >= Settings.MaxAttempts))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("%s: giving up after %d attempts"), Label, Attempts);
+        return false;
+    }
+
+    const float Delay = Settings.GetDelaySeconds(Attempts);
+    ++Attempts;
+    ++TotalAttempts;
+    UE_LOG(LogTemp, Log, TEXT("%s: retrying in %.1f seconds (attempt %d)"), Label, Delay, Attempts);
+
+    Pending = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [this, Reconnect = MoveTemp(Reconnect)](float)
+        {
+            Pending.Reset();
+            Reconnect();
+            return false;
+        }), Delay);
+    return true;
+}
+
+void FInterverseReconnector::Cancel()
+{
+    if (Pending.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(Pending);
+        Pending.Reset();
+    }
+}
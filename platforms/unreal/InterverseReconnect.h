@@ -0,0 +1,38 @@
+// platforms/unreal/InterverseReconnect.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "InterverseTypes.h"
+
+// Runs reconnect (or other retry) attempts on the core ticker according to FInterverseReconnectSettings. Game thread only.
+class INTERVERSESDK_API FInterverseReconnector
+{
+public:
+    // Label names what is being retried in log messages
+    explicit FInterverseReconnector(const TCHAR* InLabel = TEXT("WebSocket")) : Label(InLabel) {}
+    ~FInterverseReconnector() { Cancel(); }
+
+    void Configure(const FInterverseReconnectSettings& InSettings) { Settings = InSettings; }
+
+    // Schedules Reconnect after the next backoff delay. Returns false when reconnection is disabled
+    // or the attempts are exhausted; an attempt that is already scheduled is kept.
+    bool Schedule(TFunction<void()> Reconnect);
+
+    void Cancel();
+
+    // Call once a connection has been established
+    void ResetAttempts() { Attempts = 0; }
+
+    int32 GetAttempts() const { return Attempts; }
+    // Attempts scheduled over the reconnector's lifetime, for telemetry
+    int32 GetTotalAttempts() const { return TotalAttempts; }
+    bool IsScheduled() const { return Pending.IsValid(); }
+
+private:
+    const TCHAR* Label;
+    FInterverseReconnectSettings Settings;
+    int32 Attempts = 0;
+    int32 TotalAttempts = 0;
+    FTSTicker::FDelegateHandle Pending;
+};
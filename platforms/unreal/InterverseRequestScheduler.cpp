@@ -0,0 +1,175 @@
+#include "InterverseRequestScheduler.h"
+#include "Interfaces/IHttpResponse.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "InterverseTelemetry.h"
+
+FInterverseRequestScheduler::FInterverseRequestScheduler(int32 InMaxInFlightPerHost)
+    : MaxInFlightPerHost(FMath::Max(1, InMaxInFlightPerHost))
+{
+}
+
+void FInterverseRequestScheduler::Submit(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, EInterverseRequestPriority Priority)
+{
+    const FString Host = FGenericPlatformHttp::GetUrlDomain(Request->GetURL());
+    FHostState& State = Hosts.FindOrAdd(Host);
+
+    const int32 QueueIndex = FMath::Clamp(static_cast<int32>(Priority), 0, NumPriorities - 1);
+    State.Queues[QueueIndex].Add({ Request, FPlatformTime::Seconds() });
+
+    int32 QueueDepth = 0;
+    for (const TPair<FString, FHostState>& Pair : Hosts)
+    {
+        for (const TArray<FPendingRequest>& Queue : Pair.Value.Queues)
+        {
+            QueueDepth += Queue.Num();
+        }
+    }
+    PeakQueueDepth = FMath::Max(PeakQueueDepth, QueueDepth);
+
+    Pump(Host);
+}
+
+void FInterverseRequestScheduler::SetMaxInFlightPerHost(int32 InMaxInFlightPerHost)
+{
+    MaxInFlightPerHost = FMath::Max(1, InMaxInFlightPerHost);
+
+    TArray<FString> HostNames;
+    Hosts.GetKeys(HostNames);
+    for (const FString& Host : HostNames)
+    {
+        Pump(Host);
+    }
+}
+
+void FInterverseRequestScheduler::CancelAll()
+{
+    TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> Unsent;
+    for (const TPair<FString, FHostState>& Pair : Hosts)
+    {
+        for (const TArray<FPendingRequest>& Queue : Pair.Value.Queues)
+        {
+            for (const FPendingRequest& Pending : Queue)
+            {
+                Unsent.Add(Pending.Request);
+            }
+        }
+    }
+    Hosts.Reset();
+
+    // Completion delegates run below and must not touch the cleared state
+    TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> Cancelled = MoveTemp(ActiveRequests);
+    ActiveRequests.Reset();
+
+    // Queued requests were never sent, so they fail the way an unreachable node does
+    for (const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request : Unsent)
+    {
+        Request->OnProcessRequestComplete().ExecuteIfBound(Request, nullptr, false);
+    }
+    for (const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request : Cancelled)
+    {
+        Request->CancelRequest();
+    }
+}
+
+FInterverseRequestQueueStats FInterverseRequestScheduler::GetStats() const
+{
+    FInterverseRequestQueueStats Stats;
+    for (const TPair<FString, FHostState>& Pair : Hosts)
+    {
+        Stats.InFlight += Pair.Value.InFlight;
+        Stats.QueuedInteractive += Pair.Value.Queues[static_cast<int32>(EInterverseRequestPriority::Interactive)].Num();
+        Stats.QueuedNormal += Pair.Value.Queues[static_cast<int32>(EInterverseRequestPriority::Normal)].Num();
+        Stats.QueuedBackground += Pair.Value.Queues[static_cast<int32>(EInterverseRequestPriority::Background)].Num();
+    }
+    Stats.PeakQueueDepth = PeakQueueDepth;
+    Stats.CompletedRequests = CompletedRequests;
+    Stats.AverageQueueWaitMs = DispatchedRequests > 0
+        ? static_cast<float>(TotalQueueWaitSeconds * 1000.0 / DispatchedRequests) : 0.0f;
+    Stats.BytesSent = BytesSent;
+    Stats.BytesReceived = BytesReceived;
+    return Stats;
+}
+
+void FInterverseRequestScheduler::Pump(const FString& Host)
+{
+    FHostState* State = Hosts.Find(Host);
+    while (State && State->InFlight < MaxInFlightPerHost)
+    {
+        TArray<FPendingRequest>* Queue = nullptr;
+        for (TArray<FPendingRequest>& Candidate : State->Queues)
+        {
+            if (Candidate.Num() > 0)
+            {
+                Queue = &Candidate;
+                break;
+            }
+        }
+
+        if (!Queue)
+        {
+            return;
+        }
+
+        // FIFO within a priority class
+        FPendingRequest Pending = (*Queue)[0];
+        Queue->RemoveAt(0, 1, false);
+        Dispatch(Host, MoveTemp(Pending));
+
+        // Dispatch may complete synchronously and re-enter; look the state up again
+        State = Hosts.Find(Host);
+    }
+}
+
+void FInterverseRequestScheduler::Dispatch(const FString& Host, FPendingRequest&& Pending)
+{
+    FHostState& State = Hosts.FindChecked(Host);
+    ++State.InFlight;
+    ++DispatchedRequests;
+    TotalQueueWaitSeconds += FPlatformTime::Seconds() - Pending.EnqueueTime;
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Pending.Request;
+    ActiveRequests.Add(Request);
+
+    FHttpRequestCompleteDelegate Original = Request->OnProcessRequestComplete();
+    TWeakPtr<FInterverseRequestScheduler> WeakThis = AsShared();
+    Request->OnProcessRequestComplete().BindLambda(
+        [WeakThis, Host, Original](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+        {
+            Original.ExecuteIfBound(Req, Response, bSuccess);
+
+            if (TSharedPtr<FInterverseRequestScheduler> This = WeakThis.Pin())
+            {
+                if (Req.IsValid())
+                {
+                    This->OnRequestFinished(Host, Req.ToSharedRef(), Response);
+                }
+            }
+        });
+
+    Request->ProcessRequest();
+}
+
+void FInterverseRequestScheduler::OnRequestFinished(const FString& Host, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+                                                    const FHttpResponsePtr& Response)
+{
+    if (ActiveRequests.RemoveSingleSwap(Request, false) == 0)
+    {
+        // Cancelled through CancelAll
+        return;
+    }
+
+    ++CompletedRequests;
+
+    const int64 RequestBytes = Request->GetContentLength();
+    const int64 ResponseBytes = Response.IsValid() ? Response->GetContentLength() : 0;
+    BytesSent += RequestBytes;
+    BytesReceived += ResponseBytes;
+    INC_DWORD_STAT_BY(STAT_InterverseHttpBytesSent, RequestBytes);
+    INC_DWORD_STAT_BY(STAT_InterverseHttpBytesReceived, ResponseBytes);
+
+    if (FHostState* State = Hosts.Find(Host))
+    {
+        State->InFlight = FMath::Max(0, State->InFlight - 1);
+    }
+    Pump(Host);
+}
@@ -0,0 +1,59 @@
+// platforms/unreal/InterverseRequestScheduler.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "InterverseTypes.h"
+
+/**
+ * Queues SDK HTTP requests per host and releases them by priority, never exceeding the
+ * in-flight cap per host. Connections are reused by the HTTP module (keep-alive) as long as the
+ * number of concurrent requests to the node stays within its connection pool, which the cap ensures.
+ * Game thread only.
+ */
+class INTERVERSESDK_API FInterverseRequestScheduler : public TSharedFromThis<FInterverseRequestScheduler>
+{
+public:
+    explicit FInterverseRequestScheduler(int32 InMaxInFlightPerHost);
+
+    // The request's completion delegate must already be bound; it still fires exactly once
+    void Submit(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, EInterverseRequestPriority Priority);
+
+    void SetMaxInFlightPerHost(int32 InMaxInFlightPerHost);
+
+    // Completes queued requests as failed without sending them and cancels in-flight requests
+    void CancelAll();
+
+    FInterverseRequestQueueStats GetStats() const;
+
+private:
+    static constexpr int32 NumPriorities = 3;
+
+    struct FPendingRequest
+    {
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request;
+        double EnqueueTime;
+    };
+
+    struct FHostState
+    {
+        int32 InFlight = 0;
+        TArray<FPendingRequest> Queues[NumPriorities];
+    };
+
+    void Pump(const FString& Host);
+    void Dispatch(const FString& Host, FPendingRequest&& Pending);
+    void OnRequestFinished(const FString& Host, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+                           const FHttpResponsePtr& Response);
+
+    int32 MaxInFlightPerHost;
+    TMap<FString, FHostState> Hosts;
+    TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> ActiveRequests;
+
+    int32 CompletedRequests = 0;
+    int32 PeakQueueDepth = 0;
+    int32 DispatchedRequests = 0;
+    double TotalQueueWaitSeconds = 0.0;
+    int64 BytesSent = 0;
+    int64 BytesReceived = 0;
+};
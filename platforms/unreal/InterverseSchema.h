@@ -0,0 +1,319 @@
+// platforms/unreal/InterverseSchema.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonWriter.h"
+#include "InterverseTypes.h"
+
+/**
+ * Compile-time field tables of the Interverse structs.
+ *
+ * Each TInterverseSchema specialization lists the fields of one struct once, in the order of its binary
+ * record, with the JSON name they travel under. The JSON functions below and the binary codec walk the
+ * table through VisitFields, so every struct gets its own expanded encoder and decoder and each field
+ * resolves to an overload picked by its member type: no reflection lookups or name switches per field
+ * at runtime. Must match the RecordSchema tables of core/codec.py.
+ */
+
+enum class EInterverseFieldFlags : uint8
+{
+    None      = 0,
+    OmitEmpty = 1 << 0      // Left out of written JSON when empty
+};
+ENUM_CLASS_FLAGS(EInterverseFieldFlags)
+
+template <typename StructType, typename MemberType>
+struct TInterverseField
+{
+    const TCHAR* Name;
+    MemberType StructType::* Member;
+    EInterverseFieldFlags Flags;
+    const TCHAR* Alias;     // Older name still accepted when reading
+
+    constexpr bool HasFlag(EInterverseFieldFlags Flag) const { return EnumHasAnyFlags(Flags, Flag); }
+};
+
+template <typename StructType, typename MemberType>
+constexpr TInterverseField<StructType, MemberType> InterverseField(const TCHAR* Name, MemberType StructType::* Member,
+    EInterverseFieldFlags Flags = EInterverseFieldFlags::None, const TCHAR* Alias = nullptr)
+{
+    return { Name, Member, Flags, Alias };
+}
+
+// Highest known value and the value unknown names or bytes from newer writers fall back to
+template <typename EnumType>
+struct TInterverseEnumSchema;
+
+template <>
+struct TInterverseEnumSchema<EInterverseItemCategory>
+{
+    static constexpr EInterverseItemCategory Last = EInterverseItemCategory::Pet;
+    static constexpr EInterverseItemCategory Fallback = EInterverseItemCategory::Cosmetic;
+};
+
+template <>
+struct TInterverseEnumSchema<EInterverseRarity>
+{
+    static constexpr EInterverseRarity Last = EInterverseRarity::Mythic;
+    static constexpr EInterverseRarity Fallback = EInterverseRarity::Common;
+};
+
+template <typename StructType>
+struct TInterverseSchema;
+
+template <>
+struct TInterverseSchema<FInterverseBaseProperties>
+{
+    template <typename VisitorType>
+    static void VisitFields(VisitorType&& Visitor)
+    {
+        using FStruct = FInterverseBaseProperties;
+        Visitor(InterverseField(TEXT("category"), &FStruct::Category));
+        Visitor(InterverseField(TEXT("rarity"), &FStruct::Rarity));
+        Visitor(InterverseField(TEXT("level"), &FStruct::Level));
+        Visitor(InterverseField(TEXT("model_id"), &FStruct::ModelIdentifier));
+        Visitor(InterverseField(TEXT("primary_color"), &FStruct::PrimaryColor));
+        Visitor(InterverseField(TEXT("secondary_color"), &FStruct::SecondaryColor));
+        Visitor(InterverseField(TEXT("numeric_properties"), &FStruct::NumericProperties));
+        Visitor(InterverseField(TEXT("string_properties"), &FStruct::StringProperties));
+        Visitor(InterverseField(TEXT("tags"), &FStruct::Tags));
+        Visitor(InterverseField(TEXT("owner_global_id"), &FStruct::OwnerGlobalID, EInterverseFieldFlags::OmitEmpty));
+        Visitor(InterverseField(TEXT("target_player_id"), &FStruct::TargetPlayerID, EInterverseFieldFlags::OmitEmpty));
+    }
+};
+
+template <>
+struct TInterverseSchema<FInterverseAsset>
+{
+    template <typename VisitorType>
+    static void VisitFields(VisitorType&& Visitor)
+    {
+        using FStruct = FInterverseAsset;
+        Visitor(InterverseField(TEXT("asset_id"), &FStruct::AssetId, EInterverseFieldFlags::None, TEXT("id")));
+        Visitor(InterverseField(TEXT("owner"), &FStruct::Owner));
+        Visitor(InterverseField(TEXT("owner_global_id"), &FStruct::OwnerGlobalID, EInterverseFieldFlags::OmitEmpty));
+        Visitor(InterverseField(TEXT("category"), &FStruct::Category, EInterverseFieldFlags::None, TEXT("asset_type")));
+        Visitor(InterverseField(TEXT("rarity"), &FStruct::Rarity));
+        Visitor(InterverseField(TEXT("metadata"), &FStruct::Metadata));
+        Visitor(InterverseField(TEXT("game_id"), &FStruct::GameId));
+        Visitor(InterverseField(TEXT("created_at"), &FStruct::CreatedAt, EInterverseFieldFlags::OmitEmpty));
+        Visitor(InterverseField(TEXT("modified_at"), &FStruct::ModifiedAt, EInterverseFieldFlags::OmitEmpty));
+    }
+};
+
+template <>
+struct TInterverseSchema<FInterverseTransaction>
+{
+    template <typename VisitorType>
+    static void VisitFields(VisitorType&& Visitor)
+    {
+        using FStruct = FInterverseTransaction;
+        Visitor(InterverseField(TEXT("id"), &FStruct::Id));
+        Visitor(InterverseField(TEXT("sender_address"), &FStruct::SenderAddress));
+        Visitor(InterverseField(TEXT("recipient_address"), &FStruct::RecipientAddress));
+        Visitor(InterverseField(TEXT("amount"), &FStruct::Amount));
+        Visitor(InterverseField(TEXT("transaction_type"), &FStruct::TransactionType));
+        Visitor(InterverseField(TEXT("status"), &FStruct::Status));
+        Visitor(InterverseField(TEXT("timestamp"), &FStruct::Timestamp, EInterverseFieldFlags::OmitEmpty));
+        Visitor(InterverseField(TEXT("metadata"), &FStruct::Metadata));
+    }
+};
+
+// JSON only; wallets have no binary record
+template <>
+struct TInterverseSchema<FInterverseWallet>
+{
+    template <typename VisitorType>
+    static void VisitFields(VisitorType&& Visitor)
+    {
+        using FStruct = FInterverseWallet;
+        Visitor(InterverseField(TEXT("address"), &FStruct::Address));
+        Visitor(InterverseField(TEXT("balance"), &FStruct::Balance));
+        Visitor(InterverseField(TEXT("public_key"), &FStruct::PublicKey));
+        Visitor(InterverseField(TEXT("created_at"), &FStruct::CreatedAt, EInterverseFieldFlags::OmitEmpty));
+        Visitor(InterverseField(TEXT("last_updated"), &FStruct::LastUpdated, EInterverseFieldFlags::OmitEmpty));
+    }
+};
+
+namespace InterverseSchema
+{
+    namespace Private
+    {
+        inline bool IsEmptyValue(const FString& Value) { return Value.IsEmpty(); }
+        inline bool IsEmptyValue(const FDateTime& Value) { return Value.GetTicks() == 0; }
+
+        template <typename ValueType>
+        bool IsEmptyValue(const ValueType&) { return false; }
+
+        template <typename WriterType>
+        void WriteValue(WriterType& Writer, const TCHAR* Name, const FString& Value) { Writer.WriteValue(Name, Value); }
+
+        template <typename WriterType>
+        void WriteValue(WriterType& Writer, const TCHAR* Name, int32 Value) { Writer.WriteValue(Name, Value); }
+
+        template <typename WriterType>
+        void WriteValue(WriterType& Writer, const TCHAR* Name, float Value) { Writer.WriteValue(Name, Value); }
+
+        template <typename WriterType>
+        void WriteValue(WriterType& Writer, const TCHAR* Name, const FDateTime& Value) { Writer.WriteValue(Name, Value.ToIso8601()); }
+
+        template <typename WriterType, typename EnumType, typename = typename TEnableIf<TIsEnum<EnumType>::Value>::Type>
+        void WriteValue(WriterType& Writer, const TCHAR* Name, EnumType Value)
+        {
+            Writer.WriteValue(Name, StaticEnum<EnumType>()->GetNameStringByValue(static_cast<int64>(Value)));
+        }
+
+        template <typename WriterType>
+        void WriteValue(WriterType& Writer, const TCHAR* Name, const FLinearColor& Value)
+        {
+            Writer.WriteObjectStart(Name);
+            Writer.WriteValue(TEXT("r"), Value.R);
+            Writer.WriteValue(TEXT("g"), Value.G);
+            Writer.WriteValue(TEXT("b"), Value.B);
+            Writer.WriteValue(TEXT("a"), Value.A);
+            Writer.WriteObjectEnd();
+        }
+
+        template <typename WriterType, typename ValueType>
+        void WriteValue(WriterType& Writer, const TCHAR* Name, const TMap<FString, ValueType>& Value)
+        {
+            Writer.WriteObjectStart(Name);
+            for (const TPair<FString, ValueType>& Pair : Value)
+            {
+                Writer.WriteValue(Pair.Key, Pair.Value);
+            }
+            Writer.WriteObjectEnd();
+        }
+
+        template <typename WriterType>
+        void WriteValue(WriterType& Writer, const TCHAR* Name, const TArray<FString>& Value)
+        {
+            Writer.WriteArrayStart(Name);
+            for (const FString& Element : Value)
+            {
+                Writer.WriteValue(Element);
+            }
+            Writer.WriteArrayEnd();
+        }
+
+        inline void ReadValue(const FJsonValue& Json, FString& OutValue) { Json.TryGetString(OutValue); }
+
+        inline void ReadValue(const FJsonValue& Json, int32& OutValue) { Json.TryGetNumber(OutValue); }
+
+        inline void ReadValue(const FJsonValue& Json, float& OutValue)
+        {
+            double Number;
+            if (Json.TryGetNumber(Number))
+            {
+                OutValue = static_cast<float>(Number);
+            }
+        }
+
+        inline void ReadValue(const FJsonValue& Json, FDateTime& OutValue)
+        {
+            FString DateString;
+            if (Json.TryGetString(DateString))
+            {
+                FDateTime::ParseIso8601(*DateString, OutValue);
+            }
+        }
+
+        template <typename EnumType, typename = typename TEnableIf<TIsEnum<EnumType>::Value>::Type>
+        void ReadValue(const FJsonValue& Json, EnumType& OutValue)
+        {
+            FString Name;
+            if (Json.TryGetString(Name))
+            {
+                const int64 Value = StaticEnum<EnumType>()->GetValueByNameString(Name);
+                OutValue = Value != INDEX_NONE ? static_cast<EnumType>(Value) : TInterverseEnumSchema<EnumType>::Fallback;
+            }
+        }
+
+        inline void ReadValue(const FJsonValue& Json, FLinearColor& OutValue)
+        {
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (Json.TryGetObject(Object))
+            {
+                double Channel;
+                if ((*Object)->TryGetNumberField(TEXT("r"), Channel)) { OutValue.R = static_cast<float>(Channel); }
+                if ((*Object)->TryGetNumberField(TEXT("g"), Channel)) { OutValue.G = static_cast<float>(Channel); }
+                if ((*Object)->TryGetNumberField(TEXT("b"), Channel)) { OutValue.B = static_cast<float>(Channel); }
+                if ((*Object)->TryGetNumberField(TEXT("a"), Channel)) { OutValue.A = static_cast<float>(Channel); }
+            }
+        }
+
+        // Entries are added to the map, so a partial update (asset delta) keeps the other keys
+        inline void ReadValue(const FJsonValue& Json, TMap<FString, FString>& OutValue)
+        {
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (Json.TryGetObject(Object))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Object)->Values)
+                {
+                    FString Value;
+                    TArray<FString> Values;
+                    if (Pair.Value.IsValid() && Pair.Value->TryGetString(Value))
+                    {
+                        OutValue.Add(Pair.Key, MoveTemp(Value));
+                    }
+                    // Lists such as "tags" are kept comma separated
+                    else if (Pair.Value.IsValid() && Pair.Value->TryGetStringArray(Values))
+                    {
+                        OutValue.Add(Pair.Key, FString::Join(Values, TEXT(",")));
+                    }
+                }
+            }
+        }
+
+        inline void ReadValue(const FJsonValue& Json, TMap<FString, float>& OutValue)
+        {
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (Json.TryGetObject(Object))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Object)->Values)
+                {
+                    double Number;
+                    if (Pair.Value.IsValid() && Pair.Value->TryGetNumber(Number))
+                    {
+                        OutValue.Add(Pair.Key, static_cast<float>(Number));
+                    }
+                }
+            }
+        }
+
+        inline void ReadValue(const FJsonValue& Json, TArray<FString>& OutValue) { Json.TryGetStringArray(OutValue); }
+    }
+
+    // Writes the fields of Value into the object currently open in Writer
+    template <typename WriterType, typename StructType>
+    void WriteJson(WriterType& Writer, const StructType& Value)
+    {
+        TInterverseSchema<StructType>::VisitFields([&Writer, &Value](const auto& Field)
+        {
+            const auto& Member = Value.*Field.Member;
+            if (!Field.HasFlag(EInterverseFieldFlags::OmitEmpty) || !Private::IsEmptyValue(Member))
+            {
+                Private::WriteValue(Writer, Field.Name, Member);
+            }
+        });
+    }
+
+    // Reads the fields present in Object (or under their alias) into OutValue; absent fields keep their value
+    template <typename StructType>
+    void ReadJson(const FJsonObject& Object, StructType& OutValue)
+    {
+        TInterverseSchema<StructType>::VisitFields([&Object, &OutValue](const auto& Field)
+        {
+            const TSharedPtr<FJsonValue>* Json = Object.Values.Find(Field.Name);
+            if (!Json && Field.Alias)
+            {
+                Json = Object.Values.Find(Field.Alias);
+            }
+            if (Json && Json->IsValid())
+            {
+                Private::ReadValue(**Json, OutValue.*Field.Member);
+            }
+        });
+    }
+}
@@ -0,0 +1,595 @@
+#include "InterverseSocketEvents.h"
+#include "InterverseSDKComponent.h"
+#include "InterverseBinaryCodec.h"
+#include "IWebSocket.h"
+#include "Async/Async.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+void FInterverseSocketEvent::Reset()
+{
+    Type = EInterverseSocketEventType::Unknown;
+    RawMessage.Reset();
+
+    Asset.AssetId.Reset();
+    Asset.Owner.Reset();
+    Asset.OwnerGlobalID.Reset();
+    Asset.Category = EInterverseItemCategory::Weapon;
+    Asset.Rarity = EInterverseRarity::Common;
+    Asset.Metadata.Reset();
+    Asset.GameId.Reset();
+    Asset.CreatedAt = FDateTime();
+    Asset.ModifiedAt = FDateTime();
+
+    Transaction.Id.Reset();
+    Transaction.SenderAddress.Reset();
+    Transaction.RecipientAddress.Reset();
+    Transaction.Amount = 0.0f;
+    Transaction.TransactionType.Reset();
+    Transaction.Status.Reset();
+    Transaction.Timestamp = FDateTime();
+    Transaction.Metadata.Reset();
+
+    Address.Reset();
+    Balance = 0.0f;
+    bSuccess = false;
+    DeltaFields = EInterverseAssetFields::None;
+    RemovedMetadata.Reset();
+    Sequence = 0;
+    ResumeToken.Reset();
+    EnqueueTime = 0.0;
+}
+
+bool FInterverseSocketEvent::Decode(const FString& Message, FInterverseSocketEvent& OutEvent)
+{
+    // Append keeps the buffer of a recycled event
+    OutEvent.RawMessage.Reset();
+    OutEvent.RawMessage.Append(Message);
+
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    FString MessageType;
+    JsonObject->TryGetStringField(TEXT("type"), MessageType);
+
+    const TSharedPtr<FJsonObject>* Data = nullptr;
+    JsonObject->TryGetObjectField(TEXT("data"), Data);
+
+    JsonObject->TryGetNumberField(TEXT("seq"), OutEvent.Sequence);
+
+    if (MessageType == TEXT("welcome"))
+    {
+        JsonObject->TryGetStringField(TEXT("resume_token"), OutEvent.ResumeToken);
+        OutEvent.Type = EInterverseSocketEventType::Welcome;
+    }
+    else if (MessageType == TEXT("asset_update") || MessageType == TEXT("new_asset"))
+    {
+        const TSharedPtr<FJsonObject>* AssetJson = nullptr;
+        if (JsonObject->TryGetObjectField(TEXT("asset"), AssetJson)
+            && UInterverseSDKComponent::ParseAssetFromJson(*AssetJson, OutEvent.Asset))
+        {
+            OutEvent.Type = EInterverseSocketEventType::AssetUpdated;
+            OutEvent.Address = OutEvent.Asset.Owner;
+        }
+    }
+    else if (MessageType == TEXT("asset_delta"))
+    {
+        // Only changed fields are sent; they are merged into the cached asset on the game thread
+        const TSharedPtr<FJsonObject>* Changes = nullptr;
+        FString AssetId;
+        if (JsonObject->TryGetStringField(TEXT("asset_id"), AssetId)
+            && JsonObject->TryGetObjectField(TEXT("changes"), Changes))
+        {
+            UInterverseSDKComponent::ParseAssetFromJson(*Changes, OutEvent.Asset);
+            OutEvent.Asset.AssetId = AssetId;
+
+            static const TPair<const TCHAR*, EInterverseAssetFields> FieldNames[] = {
+                { TEXT("owner"), EInterverseAssetFields::Owner },
+                { TEXT("owner_global_id"), EInterverseAssetFields::OwnerGlobalID },
+                { TEXT("category"), EInterverseAssetFields::Category },
+                { TEXT("asset_type"), EInterverseAssetFields::Category },
+                { TEXT("rarity"), EInterverseAssetFields::Rarity },
+                { TEXT("game_id"), EInterverseAssetFields::GameId },
+                { TEXT("created_at"), EInterverseAssetFields::CreatedAt },
+                { TEXT("modified_at"), EInterverseAssetFields::ModifiedAt }
+            };
+            for (const TPair<const TCHAR*, EInterverseAssetFields>& Field : FieldNames)
+            {
+                if ((*Changes)->HasField(Field.Key))
+                {
+                    OutEvent.DeltaFields |= Field.Value;
+                }
+            }
+
+            // The current owner and game are always sent for routing, changed or not
+            if (!EnumHasAnyFlags(OutEvent.DeltaFields, EInterverseAssetFields::Owner))
+            {
+                JsonObject->TryGetStringField(TEXT("owner"), OutEvent.Asset.Owner);
+            }
+            if (!EnumHasAnyFlags(OutEvent.DeltaFields, EInterverseAssetFields::GameId))
+            {
+                JsonObject->TryGetStringField(TEXT("game_id"), OutEvent.Asset.GameId);
+            }
+            JsonObject->TryGetStringArrayField(TEXT("removed_metadata"), OutEvent.RemovedMetadata);
+
+            OutEvent.Address = OutEvent.Asset.Owner;
+            OutEvent.Type = EInterverseSocketEventType::AssetDelta;
+        }
+    }
+    else if (MessageType == TEXT("balance_update") && Data)
+    {
+        double Balance = 0.0;
+        (*Data)->TryGetStringField(TEXT("address"), OutEvent.Address);
+        (*Data)->TryGetNumberField(TEXT("balance"), Balance);
+        OutEvent.Balance = static_cast<float>(Balance);
+        OutEvent.Type = EInterverseSocketEventType::BalanceUpdated;
+    }
+    else if (MessageType == TEXT("transfer_complete") && Data)
+    {
+        FInterverseTransaction& Transaction = OutEvent.Transaction;
+        FString AssetId;
+        (*Data)->TryGetStringField(TEXT("transaction_id"), Transaction.Id);
+        (*Data)->TryGetStringField(TEXT("sender"), Transaction.SenderAddress);
+        (*Data)->TryGetStringField(TEXT("recipient"), Transaction.RecipientAddress);
+        (*Data)->TryGetStringField(TEXT("asset_id"), AssetId);
+        (*Data)->TryGetBoolField(TEXT("success"), OutEvent.bSuccess);
+
+        Transaction.TransactionType = TEXT("TRANSFER");
+        Transaction.Status = OutEvent.bSuccess ? TEXT("completed") : TEXT("failed");
+        Transaction.Timestamp = FDateTime::UtcNow();
+        Transaction.Metadata.Add(TEXT("asset_id"), AssetId);
+
+        OutEvent.Address = Transaction.RecipientAddress;
+        OutEvent.Type = EInterverseSocketEventType::TransferComplete;
+    }
+
+    return true;
+}
+
+void FInterverseSocketEvent::ApplyDelta(FInterverseAsset& InOutAsset) const
+{
+    if (!Asset.Owner.IsEmpty())
+    {
+        InOutAsset.Owner = Asset.Owner;
+    }
+    if (EnumHasAnyFlags(DeltaFields, EInterverseAssetFields::OwnerGlobalID))
+    {
+        InOutAsset.OwnerGlobalID = Asset.OwnerGlobalID;
+    }
+    if (EnumHasAnyFlags(DeltaFields, EInterverseAssetFields::Category))
+    {
+        InOutAsset.Category = Asset.Category;
+    }
+    if (EnumHasAnyFlags(DeltaFields, EInterverseAssetFields::Rarity))
+    {
+        InOutAsset.Rarity = Asset.Rarity;
+    }
+    if (EnumHasAnyFlags(DeltaFields, EInterverseAssetFields::GameId))
+    {
+        InOutAsset.GameId = Asset.GameId;
+    }
+    if (EnumHasAnyFlags(DeltaFields, EInterverseAssetFields::CreatedAt))
+    {
+        InOutAsset.CreatedAt = Asset.CreatedAt;
+    }
+    if (EnumHasAnyFlags(DeltaFields, EInterverseAssetFields::ModifiedAt))
+    {
+        InOutAsset.ModifiedAt = Asset.ModifiedAt;
+    }
+
+    for (const TPair<FString, FString>& Pair : Asset.Metadata)
+    {
+        InOutAsset.Metadata.Add(Pair.Key, Pair.Value);
+    }
+    for (const FString& Key : RemovedMetadata)
+    {
+        InOutAsset.Metadata.Remove(Key);
+    }
+}
+
+bool FInterverseSocketEvent::DecodeBinary(TArrayView<const uint8> Frame, FInterverseSocketEvent& OutEvent)
+{
+    EInterverseBinaryRecord RecordType;
+    if (!FInterverseBinaryCodec::PeekRecordType(Frame, RecordType))
+    {
+        return false;
+    }
+
+    switch (RecordType)
+    {
+    case EInterverseBinaryRecord::Event:
+    {
+        int64 Sequence = 0;
+        TArrayView<const uint8> Record;
+        if (FInterverseBinaryCodec::DecodeEventFrame(Frame, Sequence, Record) && DecodeBinary(Record, OutEvent))
+        {
+            OutEvent.Sequence = Sequence;
+            return true;
+        }
+        break;
+    }
+
+    case EInterverseBinaryRecord::Asset:
+        if (FInterverseBinaryCodec::DecodeAsset(Frame, OutEvent.Asset))
+        {
+            OutEvent.Type = EInterverseSocketEventType::AssetUpdated;
+            OutEvent.Address = OutEvent.Asset.Owner;
+            return true;
+        }
+        break;
+
+    case EInterverseBinaryRecord::Balance:
+        if (FInterverseBinaryCodec::DecodeBalance(Frame, OutEvent.Address, OutEvent.Balance))
+        {
+            OutEvent.Type = EInterverseSocketEventType::BalanceUpdated;
+            return true;
+        }
+        break;
+
+    case EInterverseBinaryRecord::Transaction:
+        if (FInterverseBinaryCodec::DecodeTransaction(Frame, OutEvent.Transaction))
+        {
+            OutEvent.bSuccess = OutEvent.Transaction.Status == TEXT("completed");
+            OutEvent.Address = OutEvent.Transaction.RecipientAddress;
+            OutEvent.Type = EInterverseSocketEventType::TransferComplete;
+            return true;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+bool FInterverseSocketEvent::DecodeCompressed(TArrayView<const uint8> Frame, FInterverseSocketEvent& OutEvent, int32& OutInflatedSize)
+{
+    TArray<uint8> Payload;
+    if (!FInterverseBinaryCodec::DecompressFrame(Frame, Payload))
+    {
+        return false;
+    }
+    OutInflatedSize = Payload.Num();
+
+    EInterverseBinaryRecord RecordType;
+    if (FInterverseBinaryCodec::PeekRecordType(Payload, RecordType))
+    {
+        return DecodeBinary(Payload, OutEvent);
+    }
+
+    const FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Payload.GetData()), Payload.Num());
+    return Decode(FString(Text.Length(), Text.Get()), OutEvent);
+}
+
+FInterverseSocketTrafficStats FInterverseSocketTraffic::GetStats() const
+{
+    FInterverseSocketTrafficStats Stats;
+    Stats.MessagesReceived = MessagesReceived.Load();
+    Stats.BytesReceived = BytesReceived.Load();
+    Stats.BytesDecoded = BytesDecoded.Load();
+    Stats.MessagesSent = MessagesSent.Load();
+    Stats.BytesSent = BytesSent.Load();
+    Stats.CompressionRatio = Stats.BytesDecoded > 0
+        ? static_cast<float>(static_cast<double>(Stats.BytesReceived) / Stats.BytesDecoded) : 1.0f;
+    return Stats;
+}
+
+FInterverseSocketEventQueue::FInterverseSocketEventQueue(int32 InCapacity)
+    : Events{ TInterverseBoundedQueue<FInterverseSocketEvent>(GetSideLaneCapacity(InCapacity)),
+              TInterverseBoundedQueue<FInterverseSocketEvent>(FMath::Max(1, InCapacity)),
+              TInterverseBoundedQueue<FInterverseSocketEvent>(GetSideLaneCapacity(InCapacity)) }
+    , Count(0)
+    , PeakCount(0)
+    , Dropped(0)
+    , Capacity(FMath::Max(1, InCapacity))
+{
+}
+
+int32 FInterverseSocketEventQueue::GetSideLaneCapacity(int32 InCapacity)
+{
+    return FMath::Max(16, FMath::Max(1, InCapacity) / 4);
+}
+
+EInterverseSocketEventPriority FInterverseSocketEventQueue::GetPriority(EInterverseSocketEventType Type)
+{
+    switch (Type)
+    {
+    case EInterverseSocketEventType::Welcome:
+    case EInterverseSocketEventType::TransferComplete:
+    case EInterverseSocketEventType::BalanceUpdated:
+        return EInterverseSocketEventPriority::High;
+
+    case EInterverseSocketEventType::AssetUpdated:
+    case EInterverseSocketEventType::AssetDelta:
+        return EInterverseSocketEventPriority::Normal;
+
+    default:
+        return EInterverseSocketEventPriority::Low;
+    }
+}
+
+bool FInterverseSocketEventQueue::Enqueue(FInterverseSocketEvent&& Event)
+{
+    const EInterverseSocketEventPriority Priority = GetPriority(Event.Type);
+    const int32 NewCount = Count.IncrementExchange() + 1;
+    if (NewCount > Capacity && Priority != EInterverseSocketEventPriority::High)
+    {
+        Count.DecrementExchange();
+        Dropped.IncrementExchange();
+        return false;
+    }
+
+    Event.EnqueueTime = FPlatformTime::Seconds();
+    const bool bQueued = Events[static_cast<int32>(Priority)].Push([&Event](FInterverseSocketEvent& Slot) {
+        Slot = MoveTemp(Event);
+    });
+    if (!bQueued)
+    {
+        // The high and low priority rings are smaller than Capacity
+        Count.DecrementExchange();
+        Dropped.IncrementExchange();
+        return false;
+    }
+
+    int32 Peak = PeakCount.Load();
+    while (NewCount > Peak && !PeakCount.CompareExchange(Peak, NewCount))
+    {
+    }
+    return true;
+}
+
+bool FInterverseSocketEventQueue::Dequeue(FInterverseSocketEvent& OutEvent)
+{
+    for (TInterverseBoundedQueue<FInterverseSocketEvent>& Queue : Events)
+    {
+        if (Queue.Pop([&OutEvent](FInterverseSocketEvent& Slot) { OutEvent = MoveTemp(Slot); }))
+        {
+            Count.DecrementExchange();
+            return true;
+        }
+    }
+    return false;
+}
+
+void FInterverseSocketEventQueue::Recycle(FInterverseSocketEvent& Event)
+{
+    if (EventPool.IsValid())
+    {
+        EventPool->Release(Event);
+    }
+}
+
+void FInterverseSocketEventPool::Acquire(FInterverseSocketEvent& OutEvent)
+{
+    Events.Pop([&OutEvent](FInterverseSocketEvent& Pooled) {
+        Swap(Pooled, OutEvent);
+    });
+    OutEvent.Reset();
+}
+
+void FInterverseSocketEventPool::Release(FInterverseSocketEvent& Event)
+{
+    Events.Push([&Event](FInterverseSocketEvent& Slot) {
+        Swap(Slot, Event);
+    });
+}
+
+FInterverseSocketInbox::FInterverseSocketInbox(int32 InCapacity, const TSharedRef<FInterverseSocketTraffic, ESPMode::ThreadSafe>& InTraffic,
+                                               const TSharedRef<FInterverseSocketEventPool, ESPMode::ThreadSafe>& InEventPool,
+                                               TFunction<void(FInterverseSocketEvent&&)> InOnEvent)
+    : Messages(InCapacity)
+    , Traffic(InTraffic)
+    , EventPool(InEventPool)
+    , OnEvent(MoveTemp(InOnEvent))
+{
+}
+
+void FInterverseSocketInbox::Bind(const TSharedPtr<IWebSocket>& Socket, bool bBinaryFrames)
+{
+    TSharedRef<FInterverseSocketInbox, ESPMode::ThreadSafe> Inbox = AsShared();
+    Socket->OnMessage().AddLambda([Inbox](const FString& Message) {
+        UE_LOG(LogTemp, Verbose, TEXT("Received message: %s"), *Message);
+
+        if (!Inbox->PushText(Message))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("WebSocket inbox full (%d), dropping message"), Inbox->GetCapacity());
+        }
+    });
+
+    if (!bBinaryFrames)
+    {
+        return;
+    }
+
+    // Frames may arrive in fragments; the socket delivers them in order so no locking is needed
+    TSharedRef<TArray<uint8>> Pending = MakeShared<TArray<uint8>>();
+    Socket->OnRawMessage().AddLambda([Inbox, Pending](const void* Data, SIZE_T Size, SIZE_T BytesRemaining) {
+        Pending->Append(static_cast<const uint8*>(Data), Size);
+        if (BytesRemaining > 0)
+        {
+            return;
+        }
+
+        // Text frames are raised here too and are handled (and counted) by OnMessage
+        const bool bCompressed = FInterverseBinaryCodec::IsCompressedFrame(*Pending);
+        EInterverseBinaryRecord RecordType;
+        if (!bCompressed && !FInterverseBinaryCodec::PeekRecordType(*Pending, RecordType))
+        {
+            Pending->Reset();
+            return;
+        }
+        Inbox->Traffic->AddReceived(Pending->Num());
+
+        if (!Inbox->PushFrame(*Pending, bCompressed))
+        {
+            Pending->Reset();
+            UE_LOG(LogTemp, Warning, TEXT("WebSocket inbox full (%d), dropping frame"), Inbox->GetCapacity());
+        }
+    });
+}
+
+bool FInterverseSocketInbox::PushText(const FString& Text)
+{
+    const bool bPushed = Messages.Push([&Text](FMessage& Message) {
+        // The worker reset the slot but kept its buffer
+        Message.Text.Append(Text);
+        Message.bBinary = false;
+        Message.bCompressed = false;
+    });
+
+    if (!bPushed)
+    {
+        Dropped.IncrementExchange();
+        return false;
+    }
+    ScheduleDrain();
+    return true;
+}
+
+bool FInterverseSocketInbox::PushFrame(TArray<uint8>& Frame, bool bCompressed)
+{
+    const bool bPushed = Messages.Push([&Frame, bCompressed](FMessage& Message) {
+        Swap(Message.Frame, Frame);
+        Message.bBinary = true;
+        Message.bCompressed = bCompressed;
+    });
+
+    if (!bPushed)
+    {
+        Dropped.IncrementExchange();
+        return false;
+    }
+    ScheduleDrain();
+    return true;
+}
+
+void FInterverseSocketInbox::ScheduleDrain()
+{
+    if (!bDraining.Exchange(true))
+    {
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Inbox = AsShared()]() {
+            Inbox->Drain();
+        });
+    }
+}
+
+void FInterverseSocketInbox::Drain()
+{
+    for (;;)
+    {
+        while (Messages.Pop([this](FMessage& Message) {
+            Decode(Message);
+            Message.Text.Reset();
+            Message.Frame.Reset();
+        }))
+        {
+        }
+
+        // A message pushed after the last check saw bDraining still set and started no task, so look once more
+        bDraining.Store(false);
+        if (Messages.IsEmpty() || bDraining.Exchange(true))
+        {
+            return;
+        }
+    }
+}
+
+void FInterverseSocketInbox::Decode(FMessage& Message)
+{
+    FInterverseSocketEvent Event;
+    EventPool->Acquire(Event);
+
+    if (Message.bBinary)
+    {
+        int32 DecodedSize = Message.Frame.Num();
+        const bool bDecoded = Message.bCompressed
+            ? FInterverseSocketEvent::DecodeCompressed(Message.Frame, Event, DecodedSize)
+            : FInterverseSocketEvent::DecodeBinary(Message.Frame, Event);
+        if (!bDecoded)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Invalid %s WebSocket frame (%d bytes)"),
+                Message.bCompressed ? TEXT("compressed") : TEXT("binary"), Message.Frame.Num());
+            return;
+        }
+        Traffic->AddDecoded(DecodedSize);
+    }
+    else
+    {
+        const int32 Size = FTCHARToUTF8(*Message.Text).Length();
+        Traffic->AddReceived(Size);
+        Traffic->AddDecoded(Size);
+
+        // Invalid messages are still forwarded raw through OnWebSocketMessage
+        if (!FInterverseSocketEvent::Decode(Message.Text, Event))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Invalid JSON in WebSocket message: %s"), *Message.Text.Left(100));
+        }
+    }
+
+    OnEvent(MoveTemp(Event));
+}
+
+void FInterverseSocketSession::Observe(int64 Sequence, const FString& InResumeToken)
+{
+    bool bHeldBack = false;
+    int64 Held = HeldSequence.Load();
+    if (Held > 0)
+    {
+        if (Sequence == Held)
+        {
+            // The dropped event came back with a replay
+            HeldSequence.CompareExchange(Held, 0);
+        }
+        else if (Sequence > Held)
+        {
+            // Neither the sequence nor the token may move past the dropped event
+            Sequence = Held - 1;
+            bHeldBack = true;
+        }
+    }
+
+    // The dedicated and shared decode paths may both see a session's events, so keep the highest sequence seen
+    int64 Current = LastSequence.Load();
+    while (Sequence > Current && !LastSequence.CompareExchange(Current, Sequence))
+    {
+    }
+
+    if (!bHeldBack && !InResumeToken.IsEmpty())
+    {
+        FScopeLock Lock(&TokenLock);
+        ResumeToken = InResumeToken;
+    }
+}
+
+void FInterverseSocketSession::Hold(int64 Sequence)
+{
+    // Events without a sequence are not replayed either way
+    if (Sequence <= 0)
+    {
+        return;
+    }
+
+    int64 Held = HeldSequence.Load();
+    while ((Held == 0 || Sequence < Held) && !HeldSequence.CompareExchange(Held, Sequence))
+    {
+    }
+}
+
+FString FInterverseSocketSession::GetResumeToken() const
+{
+    FScopeLock Lock(&TokenLock);
+    return ResumeToken;
+}
+
+void FInterverseSocketSession::Reset()
+{
+    LastSequence = 0;
+    HeldSequence = 0;
+    FScopeLock Lock(&TokenLock);
+    ResumeToken.Reset();
+}
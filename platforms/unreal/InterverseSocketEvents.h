@@ -0,0 +1,247 @@
+// platforms/unreal/InterverseSocketEvents.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InterverseTypes.h"
+#include "InterverseBoundedQueue.h"
+
+class IWebSocket;
+
+enum class EInterverseSocketEventType : uint8
+{
+    Unknown,
+    Welcome,
+    AssetUpdated,
+    AssetDelta,
+    BalanceUpdated,
+    TransferComplete
+};
+
+// Asset fields carried by an "asset_delta" event
+enum class EInterverseAssetFields : uint8
+{
+    None          = 0,
+    Owner         = 1 << 0,
+    OwnerGlobalID = 1 << 1,
+    Category      = 1 << 2,
+    Rarity        = 1 << 3,
+    GameId        = 1 << 4,
+    CreatedAt     = 1 << 5,
+    ModifiedAt    = 1 << 6
+};
+ENUM_CLASS_FLAGS(EInterverseAssetFields);
+
+// A WebSocket message decoded into typed SDK data, ready for the game thread
+struct INTERVERSESDK_API FInterverseSocketEvent
+{
+    EInterverseSocketEventType Type = EInterverseSocketEventType::Unknown;
+
+    FString RawMessage;
+
+    FInterverseAsset Asset;
+    FInterverseTransaction Transaction;
+
+    FString Address;
+    float Balance = 0.0f;
+    bool bSuccess = false;
+
+    // AssetDelta: Asset holds AssetId, the current Owner and the changed fields named in DeltaFields.
+    // Asset.Metadata only has the changed entries; ApplyDelta merges them into the full version.
+    EInterverseAssetFields DeltaFields = EInterverseAssetFields::None;
+    TArray<FString> RemovedMetadata;
+
+    // Position in the node's event stream ("seq"), 0 if the message carries none
+    int64 Sequence = 0;
+
+    // Session resume token handed out with the welcome message
+    FString ResumeToken;
+
+    // FPlatformTime::Seconds() when the event was queued for the game thread
+    double EnqueueTime = 0.0;
+
+    void ApplyDelta(FInterverseAsset& InOutAsset) const;
+
+    // Clears every field but keeps the string, array and map allocations for the next decode
+    void Reset();
+
+    // Parses a raw message into a new or Reset event. Safe to call from any thread; returns false if the
+    // message is not valid JSON
+    static bool Decode(const FString& Message, FInterverseSocketEvent& OutEvent);
+
+    // Same for a complete binary frame in the FInterverseBinaryCodec format
+    static bool DecodeBinary(TArrayView<const uint8> Frame, FInterverseSocketEvent& OutEvent);
+
+    // Same for a compressed frame; OutInflatedSize is the size of the message it contained
+    static bool DecodeCompressed(TArrayView<const uint8> Frame, FInterverseSocketEvent& OutEvent, int32& OutInflatedSize);
+};
+
+// Encodings the client asks the node for in its handshake
+struct FInterverseSocketOptions
+{
+    bool bBinaryFrames = false;
+    bool bCompressFrames = false;
+    bool bAssetDeltas = false;
+};
+
+// Byte counters of one WebSocket connection; any thread
+class INTERVERSESDK_API FInterverseSocketTraffic
+{
+public:
+    void AddReceived(int64 Bytes) { BytesReceived += Bytes; }
+    void AddDecoded(int64 Bytes) { ++MessagesReceived; BytesDecoded += Bytes; }
+    void AddSent(int64 Bytes) { ++MessagesSent; BytesSent += Bytes; }
+
+    FInterverseSocketTrafficStats GetStats() const;
+
+private:
+    TAtomic<int64> MessagesReceived { 0 };
+    TAtomic<int64> BytesReceived { 0 };
+    TAtomic<int64> BytesDecoded { 0 };
+    TAtomic<int64> MessagesSent { 0 };
+    TAtomic<int64> BytesSent { 0 };
+};
+
+// Spent events handed back by the game thread, so decoding the next ones reuses their storage instead of
+// allocating new strings and maps for every message
+class INTERVERSESDK_API FInterverseSocketEventPool
+{
+public:
+    static constexpr int32 DefaultCapacity = 256;
+
+    explicit FInterverseSocketEventPool(int32 InCapacity = DefaultCapacity) : Events(InCapacity) {}
+
+    // Decode worker, one thread at a time. OutEvent is Reset and holds a recycled event's storage if there was one.
+    void Acquire(FInterverseSocketEvent& OutEvent);
+
+    // Game thread. Event is swapped for an empty one; when the pool is full it is left as it was.
+    void Release(FInterverseSocketEvent& Event);
+
+private:
+    TInterverseBoundedQueue<FInterverseSocketEvent> Events;
+};
+
+// Dispatch order of queued events; FIFO within a priority
+enum class EInterverseSocketEventPriority : uint8
+{
+    High,    // Welcome, transfers and balances: state the game acts on
+    Normal,  // Asset updates and deltas
+    Low      // Messages the SDK does not understand, only forwarded through OnWebSocketMessage
+};
+
+// Bounded multi-producer queue between the decode workers and the game thread. Each priority has its own
+// preallocated ring, so queuing an event allocates no queue node; the high and low priority rings hold a
+// quarter of Capacity, as asset events are what fills a queue.
+class INTERVERSESDK_API FInterverseSocketEventQueue
+{
+public:
+    static constexpr int32 NumPriorities = 3;
+
+    explicit FInterverseSocketEventQueue(int32 InCapacity);
+
+    static EInterverseSocketEventPriority GetPriority(EInterverseSocketEventType Type);
+
+    // Returns false and drops the event when the queue or its priority's ring is full. High priority
+    // events do not count against Capacity, so a flood of asset events cannot push out a transfer
+    // result, while their own ring still bounds a flood of them.
+    bool Enqueue(FInterverseSocketEvent&& Event);
+
+    // Game thread only; highest priority first
+    bool Dequeue(FInterverseSocketEvent& OutEvent);
+
+    // Game thread only. Hands a dispatched event back to the pool its decoder allocates from, if one is set.
+    void Recycle(FInterverseSocketEvent& Event);
+    void SetEventPool(const TSharedPtr<FInterverseSocketEventPool, ESPMode::ThreadSafe>& InEventPool) { EventPool = InEventPool; }
+
+    int32 Num() const { return Count.Load(); }
+    int32 GetPeakNum() const { return PeakCount.Load(); }
+    int32 GetCapacity() const { return Capacity; }
+    int32 GetDroppedCount() const { return Dropped.Load(); }
+
+private:
+    static int32 GetSideLaneCapacity(int32 InCapacity);
+
+    TInterverseBoundedQueue<FInterverseSocketEvent> Events[NumPriorities];
+    TAtomic<int32> Count;
+    TAtomic<int32> PeakCount;
+    TAtomic<int32> Dropped;
+    const int32 Capacity;
+
+    TSharedPtr<FInterverseSocketEventPool, ESPMode::ThreadSafe> EventPool;
+};
+
+// Preallocated ring of raw WebSocket messages between the socket thread and the decode worker.
+// Socket callbacks only copy the message into a free slot; a single worker task, started when the
+// ring goes from empty to non-empty, decodes everything queued and hands the events to OnEvent.
+// Slot buffers are reused, so a steady stream of messages allocates neither tasks nor frames.
+class INTERVERSESDK_API FInterverseSocketInbox : public TSharedFromThis<FInterverseSocketInbox, ESPMode::ThreadSafe>
+{
+public:
+    static constexpr int32 DefaultCapacity = 4096;
+
+    // Capacity is rounded up to a power of two. Events are decoded into storage taken from EventPool;
+    // OnEvent runs on the decode worker, one event at a time.
+    FInterverseSocketInbox(int32 InCapacity, const TSharedRef<FInterverseSocketTraffic, ESPMode::ThreadSafe>& InTraffic,
+                           const TSharedRef<FInterverseSocketEventPool, ESPMode::ThreadSafe>& InEventPool,
+                           TFunction<void(FInterverseSocketEvent&&)> InOnEvent);
+
+    // Binds the message handlers of Socket; binary and compressed frames are reassembled from fragments
+    // when bBinaryFrames is set. The handlers hold the inbox, so it outlives whoever opened the socket.
+    void Bind(const TSharedPtr<IWebSocket>& Socket, bool bBinaryFrames);
+
+    // Any thread. Return false and drop the message when the ring is full.
+    bool PushText(const FString& Message);
+    // Frame is swapped with the spare buffer of the slot and comes back empty
+    bool PushFrame(TArray<uint8>& Frame, bool bCompressed);
+
+    int32 GetCapacity() const { return Messages.GetCapacity(); }
+    int32 GetDroppedCount() const { return Dropped.Load(); }
+
+private:
+    struct FMessage
+    {
+        FString Text;
+        TArray<uint8> Frame;
+        bool bBinary = false;
+        bool bCompressed = false;
+    };
+
+    void ScheduleDrain();
+    // Decode worker only
+    void Drain();
+    void Decode(FMessage& Message);
+
+    // Popped only by the worker holding bDraining
+    TInterverseBoundedQueue<FMessage> Messages;
+    TAtomic<bool> bDraining { false };
+    TAtomic<int32> Dropped { 0 };
+
+    TSharedRef<FInterverseSocketTraffic, ESPMode::ThreadSafe> Traffic;
+    TSharedRef<FInterverseSocketEventPool, ESPMode::ThreadSafe> EventPool;
+    TFunction<void(FInterverseSocketEvent&&)> OnEvent;
+};
+
+// Resume state of one WebSocket session, kept across reconnects so the node only replays missed events
+class INTERVERSESDK_API FInterverseSocketSession
+{
+public:
+    // Any thread; called by the decode workers once an event is queued, so a dropped one is replayed on resume
+    void Observe(int64 Sequence, const FString& ResumeToken);
+
+    // Called instead of Observe when a queue dropped the event: the sequence stops below it until it is
+    // observed again, so the next resume replays it even if later events were queued
+    void Hold(int64 Sequence);
+
+    int64 GetLastSequence() const { return LastSequence.Load(); }
+    FString GetResumeToken() const;
+
+    void Reset();
+
+private:
+    TAtomic<int64> LastSequence { 0 };
+
+    // Oldest dropped sequence, 0 if none
+    TAtomic<int64> HeldSequence { 0 };
+
+    mutable FCriticalSection TokenLock;
+    FString ResumeToken;
+};
@@ -0,0 +1,117 @@
+#include "InterverseTelemetry.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+DEFINE_STAT(STAT_InterverseCallsInFlight);
+DEFINE_STAT(STAT_InterverseCallsCompleted);
+DEFINE_STAT(STAT_InterverseCallsFailed);
+DEFINE_STAT(STAT_InterverseHttpBytesSent);
+DEFINE_STAT(STAT_InterverseHttpBytesReceived);
+DEFINE_STAT(STAT_InterverseReconnects);
+DEFINE_STAT(STAT_InterversePendingSocketEvents);
+DEFINE_STAT(STAT_InterverseSocketEventsDispatched);
+DEFINE_STAT(STAT_InterverseWorkerTasksPending);
+
+UE_TRACE_CHANNEL_DEFINE(InterverseChannel);
+
+TRACE_DECLARE_INT_COUNTER(InterverseCallsInFlight, TEXT("Interverse/CallsInFlight"));
+TRACE_DECLARE_FLOAT_COUNTER(InterverseLastLatencyMs, TEXT("Interverse/LastLatencyMs"));
+
+void FInterverseLatencyHistogram::Record(double Milliseconds)
+{
+    Milliseconds = FMath::Max(0.0, Milliseconds);
+
+    int32 Bucket = 0;
+    if (Milliseconds > FirstBucketMs)
+    {
+        Bucket = FMath::CeilToInt(FMath::Loge(Milliseconds / FirstBucketMs) / FMath::Loge(BucketGrowth));
+    }
+    ++Buckets[FMath::Clamp(Bucket, 0, NumBuckets - 1)];
+
+    ++Count;
+    MaxMs = FMath::Max(MaxMs, Milliseconds);
+}
+
+double FInterverseLatencyHistogram::GetPercentile(double Fraction) const
+{
+    if (Count == 0)
+    {
+        return 0.0;
+    }
+
+    const int64 Rank = FMath::Max<int64>(1, FMath::CeilToInt64(FMath::Clamp(Fraction, 0.0, 1.0) * Count));
+    int64 Seen = 0;
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        Seen += Buckets[Bucket];
+        if (Seen >= Rank)
+        {
+            return FMath::Min(GetBucketUpperBound(Bucket), MaxMs);
+        }
+    }
+    return MaxMs;
+}
+
+double FInterverseLatencyHistogram::GetBucketUpperBound(int32 Bucket)
+{
+    return FirstBucketMs * FMath::Pow(BucketGrowth, static_cast<double>(Bucket));
+}
+
+double FInterverseTelemetry::Begin(EInterverseOperation Operation)
+{
+    ++GetOperation(Operation).InFlight;
+    INC_DWORD_STAT(STAT_InterverseCallsInFlight);
+    TRACE_COUNTER_INCREMENT(InterverseCallsInFlight);
+    return FPlatformTime::Seconds();
+}
+
+void FInterverseTelemetry::End(EInterverseOperation Operation, double StartTime, bool bSuccess)
+{
+    FOperation& State = GetOperation(Operation);
+    State.InFlight = FMath::Max(0, State.InFlight - 1);
+    DEC_DWORD_STAT(STAT_InterverseCallsInFlight);
+    TRACE_COUNTER_DECREMENT(InterverseCallsInFlight);
+
+    Record(Operation, FPlatformTime::Seconds() - StartTime, bSuccess);
+}
+
+void FInterverseTelemetry::Record(EInterverseOperation Operation, double Seconds, bool bSuccess)
+{
+    FOperation& State = GetOperation(Operation);
+    ++State.Count;
+    State.Latency.Record(Seconds * 1000.0);
+    INC_DWORD_STAT(STAT_InterverseCallsCompleted);
+    TRACE_COUNTER_SET(InterverseLastLatencyMs, Seconds * 1000.0);
+
+    if (!bSuccess)
+    {
+        ++State.Failures;
+        INC_DWORD_STAT(STAT_InterverseCallsFailed);
+    }
+}
+
+void FInterverseTelemetry::GetStats(TArray<FInterverseOperationStats>& OutOperations) const
+{
+    OutOperations.Reset(Operations.Num());
+    for (const TPair<EInterverseOperation, FOperation>& Pair : Operations)
+    {
+        FInterverseOperationStats& Stats = OutOperations.AddDefaulted_GetRef();
+        Stats.Operation = Pair.Key;
+        Stats.Count = Pair.Value.Count;
+        Stats.Failures = Pair.Value.Failures;
+        Stats.InFlight = Pair.Value.InFlight;
+        Stats.P50Ms = static_cast<float>(Pair.Value.Latency.GetPercentile(0.50));
+        Stats.P95Ms = static_cast<float>(Pair.Value.Latency.GetPercentile(0.95));
+        Stats.P99Ms = static_cast<float>(Pair.Value.Latency.GetPercentile(0.99));
+        Stats.MaxMs = static_cast<float>(Pair.Value.Latency.GetMax());
+    }
+
+    OutOperations.Sort([](const FInterverseOperationStats& A, const FInterverseOperationStats& B)
+    {
+        return A.Operation < B.Operation;
+    });
+}
+
+FInterverseTelemetry::FOperation& FInterverseTelemetry::GetOperation(EInterverseOperation Operation)
+{
+    return Operations.FindOrAdd(Operation);
+}
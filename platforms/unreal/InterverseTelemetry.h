@@ -0,0 +1,91 @@
+// platforms/unreal/InterverseTelemetry.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "InterverseTypes.h"
+
+// "stat Interverse" in the console; Insights shows the Interverse trace channel (-trace=cpu,counters,Interverse)
+DECLARE_STATS_GROUP(TEXT("Interverse"), STATGROUP_Interverse, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Calls In Flight"), STAT_InterverseCallsInFlight, STATGROUP_Interverse, INTERVERSESDK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Calls Completed"), STAT_InterverseCallsCompleted, STATGROUP_Interverse, INTERVERSESDK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Calls Failed"), STAT_InterverseCallsFailed, STATGROUP_Interverse, INTERVERSESDK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HTTP Bytes Sent"), STAT_InterverseHttpBytesSent, STATGROUP_Interverse, INTERVERSESDK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HTTP Bytes Received"), STAT_InterverseHttpBytesReceived, STATGROUP_Interverse, INTERVERSESDK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Reconnects"), STAT_InterverseReconnects, STATGROUP_Interverse, INTERVERSESDK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Socket Events"), STAT_InterversePendingSocketEvents, STATGROUP_Interverse, INTERVERSESDK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Socket Events Dispatched"), STAT_InterverseSocketEventsDispatched, STATGROUP_Interverse, INTERVERSESDK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Worker Tasks Pending"), STAT_InterverseWorkerTasksPending, STATGROUP_Interverse, INTERVERSESDK_API);
+
+UE_TRACE_CHANNEL_EXTERN(InterverseChannel, INTERVERSESDK_API);
+
+/**
+ * Latency histogram with logarithmic buckets, 20% apart from 0.5 ms to a few minutes.
+ * Recording is constant time and memory; percentiles are accurate to one bucket.
+ */
+class INTERVERSESDK_API FInterverseLatencyHistogram
+{
+public:
+    void Record(double Milliseconds);
+
+    // Upper bound of the bucket holding the given fraction (0..1) of the samples, capped at the maximum seen
+    double GetPercentile(double Fraction) const;
+
+    int64 Num() const { return Count; }
+    double GetMax() const { return MaxMs; }
+
+private:
+    static constexpr int32 NumBuckets = 72;
+    static constexpr double FirstBucketMs = 0.5;
+    static constexpr double BucketGrowth = 1.2;
+
+    static double GetBucketUpperBound(int32 Bucket);
+
+    uint32 Buckets[NumBuckets] = {};
+    int64 Count = 0;
+    double MaxMs = 0.0;
+};
+
+/**
+ * Call counts, failures, in-flight gauges and latency histograms per SDK operation. Game thread only.
+ * Shared so continuations that outlive the component can still record their completion.
+ */
+class INTERVERSESDK_API FInterverseTelemetry : public TSharedFromThis<FInterverseTelemetry>
+{
+public:
+    // Wraps a result continuation so the call is counted from now until it runs. ResultType needs bSuccess.
+    template <typename ResultType>
+    TFunction<void(const ResultType&)> Track(EInterverseOperation Operation, TFunction<void(const ResultType&)> OnComplete)
+    {
+        const double StartTime = Begin(Operation);
+        return [Telemetry = AsShared(), Operation, StartTime, OnComplete = MoveTemp(OnComplete)](const ResultType& Result)
+        {
+            Telemetry->End(Operation, StartTime, Result.bSuccess);
+            OnComplete(Result);
+        };
+    }
+
+    // Returns the start time to hand to End
+    double Begin(EInterverseOperation Operation);
+    void End(EInterverseOperation Operation, double StartTime, bool bSuccess);
+
+    // A completed measurement that was not started through Begin
+    void Record(EInterverseOperation Operation, double Seconds, bool bSuccess);
+
+    void GetStats(TArray<FInterverseOperationStats>& OutOperations) const;
+
+private:
+    struct FOperation
+    {
+        int32 Count = 0;
+        int32 Failures = 0;
+        int32 InFlight = 0;
+        FInterverseLatencyHistogram Latency;
+    };
+
+    FOperation& GetOperation(EInterverseOperation Operation);
+
+    TMap<EInterverseOperation, FOperation> Operations;
+};
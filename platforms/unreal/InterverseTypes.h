@@ -103,6 +103,31 @@ struct INTERVERSESDK_API FInterverseAsset
     
     UPROPERTY(BlueprintReadWrite, Category = "Interverse")
     FDateTime ModifiedAt;
+
+    // Moved by an optimistic transfer the node has not confirmed yet (bOptimisticTransfers); local only
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse")
+    bool bPendingTransfer = false;
+};
+
+// Filter over a player's cached assets; every condition must hold
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseAssetQuery
+{
+    GENERATED_BODY()
+
+    // Any of these categories; empty matches all
+    UPROPERTY(BlueprintReadWrite, Category = "Interverse")
+    TArray<EInterverseItemCategory> Categories;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Interverse")
+    EInterverseRarity MinRarity = EInterverseRarity::Common;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Interverse")
+    EInterverseRarity MaxRarity = EInterverseRarity::Mythic;
+
+    // All of these tags, as listed in the asset's comma separated "tags" metadata entry
+    UPROPERTY(BlueprintReadWrite, Category = "Interverse")
+    TArray<FString> Tags;
 };
 
 // Player identity representation
@@ -178,4 +203,359 @@ struct INTERVERSESDK_API FInterverseTransaction
     
     UPROPERTY(BlueprintReadOnly, Category = "Interverse|Transaction")
     TMap<FString, FString> Metadata;
-};
\ No newline at end of file
+};
+
+// Request priority classes of the SDK HTTP scheduler
+UENUM(BlueprintType)
+enum class EInterverseRequestPriority : uint8
+{
+    Interactive UMETA(DisplayName = "Interactive"),  // Balance reads, transfers the player waits on
+    Normal      UMETA(DisplayName = "Normal"),
+    Background  UMETA(DisplayName = "Background")    // History syncs, prefetches
+};
+
+// Queue depth metrics of the SDK HTTP scheduler
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseRequestQueueStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int32 InFlight = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int32 QueuedInteractive = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int32 QueuedNormal = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int32 QueuedBackground = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int32 PeakQueueDepth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int32 CompletedRequests = 0;
+
+    // Average time requests waited in the queue before being sent
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    float AverageQueueWaitMs = 0.0f;
+
+    // HTTP payload bytes, without headers
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int64 BytesSent = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int64 BytesReceived = 0;
+};
+
+// Per-call results of the SDK requests; Error is set when bSuccess is false
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseWalletResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Wallet")
+    bool bSuccess = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Wallet")
+    FString Error;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Wallet")
+    FInterverseWallet Wallet;
+};
+
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseBalanceResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Wallet")
+    bool bSuccess = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Wallet")
+    FString Error;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Wallet")
+    FString Address;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Wallet")
+    float Balance = 0.0f;
+};
+
+// Result of GetBalances; Balances is ordered like the requested addresses
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseBalancesResult
+{
+    GENERATED_BODY()
+
+    // False if any of the balances could not be read
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Wallet")
+    bool bSuccess = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Wallet")
+    FString Error;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Wallet")
+    TArray<FInterverseBalanceResult> Balances;
+};
+
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseMintResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    bool bSuccess = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString Error;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FInterverseAsset Asset;
+};
+
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseTransferResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    bool bSuccess = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString Error;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString AssetId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString FromAddress;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString ToAddress;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString TransactionId;
+};
+
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterversePlayerAssetsResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    bool bSuccess = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString Error;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString Address;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    TArray<FInterverseAsset> Assets;
+
+    // Served from the local cache because the node could not be reached or the TTL had not expired
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    bool bFromCache = false;
+};
+
+// Outcome of WarmUp; bSuccess only if every step succeeded
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseWarmUpResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    bool bSuccess = false;
+
+    // The first step that failed
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    FString Error;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    FString Address;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    bool bWebSocketConnected = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    bool bGameVerified = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    FInterverseBalanceResult Balance;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    FInterversePlayerAssetsResult Assets;
+
+    // From the WarmUp call until the last step finished
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    float ElapsedMs = 0.0f;
+};
+
+// One page of a paginated or streamed asset list
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseAssetPageResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    bool bSuccess = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString Error;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString Address;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    TArray<FInterverseAsset> Assets;
+
+    // Zero-based position of the page in the stream
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    int32 PageIndex = 0;
+
+    // Pass to GetPlayerAssetsPage for the following page; empty on the last page
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    FString NextCursor;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Assets")
+    bool bLastPage = false;
+};
+
+// Automatic WebSocket reconnection: capped exponential backoff with jitter
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseReconnectSettings
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Network")
+    bool bEnabled = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Network", meta = (ClampMin = "0.1"))
+    float InitialDelaySeconds = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Network", meta = (ClampMin = "0.1"))
+    float MaxDelaySeconds = 60.0f;
+
+    // 0 retries forever
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interverse|Network", meta = (ClampMin = "0"))
+    int32 MaxAttempts = 0;
+
+    // Waits between half and all of the backoff step so clients that lost the node together spread out
+    float GetDelaySeconds(int32 Attempt) const
+    {
+        const float Step = FMath::Min(MaxDelaySeconds, InitialDelaySeconds * FMath::Pow(2.0f, static_cast<float>(FMath::Min(Attempt, 16))));
+        return Step * 0.5f + FMath::FRandRange(0.0f, Step * 0.5f);
+    }
+};
+
+// Traffic of one WebSocket connection. Received bytes are counted as the frames reach the SDK, after any
+// transport-level (permessage-deflate) inflation; decoded bytes after inflating compressed frames.
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseSocketTrafficStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int64 MessagesReceived = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int64 BytesReceived = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int64 BytesDecoded = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int64 MessagesSent = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    int64 BytesSent = 0;
+
+    // BytesReceived / BytesDecoded, 1 without compression
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Network")
+    float CompressionRatio = 1.0f;
+};
+
+// SDK operations measured by the telemetry of UInterverseSDKComponent
+UENUM(BlueprintType)
+enum class EInterverseOperation : uint8
+{
+    CreateWallet        UMETA(DisplayName = "Create Wallet"),
+    GetBalance          UMETA(DisplayName = "Get Balance"),
+    GetBalances         UMETA(DisplayName = "Get Balances"),
+    MintAsset           UMETA(DisplayName = "Mint Asset"),
+    MintBatch           UMETA(DisplayName = "Mint Batch"),
+    TransferAsset       UMETA(DisplayName = "Transfer Asset"),
+    GetPlayerAssets     UMETA(DisplayName = "Get Player Assets"),
+    GetAssetPage        UMETA(DisplayName = "Get Asset Page"),
+    SocketRoundTrip     UMETA(DisplayName = "WebSocket Round Trip"),  // Handshake until the welcome message
+    SocketEventDelivery UMETA(DisplayName = "WebSocket Event Delivery"),  // Queued by the decoder until dispatched on the game thread
+    WarmUp              UMETA(DisplayName = "Warm Up")  // Until every step of the login prefetch finished
+};
+
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseOperationStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    EInterverseOperation Operation = EInterverseOperation::CreateWallet;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    int32 Count = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    int32 Failures = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    int32 InFlight = 0;
+
+    // Latency percentiles of completed calls; within one histogram bucket (about 20%) of the exact value
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    float P50Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    float P95Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    float P99Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    float MaxMs = 0.0f;
+};
+
+// Snapshot of everything UInterverseSDKComponent measures
+USTRUCT(BlueprintType)
+struct INTERVERSESDK_API FInterverseSDKStats
+{
+    GENERATED_BODY()
+
+    // One entry per EInterverseOperation that has been called
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    TArray<FInterverseOperationStats> Operations;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    FInterverseRequestQueueStats Requests;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    FInterverseSocketTrafficStats Socket;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    int32 Reconnects = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    int32 PendingSocketEvents = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    int32 PeakPendingSocketEvents = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    int32 DroppedSocketEvents = 0;
+
+    // Responses being parsed on a background thread (bParseResponsesOffGameThread)
+    UPROPERTY(BlueprintReadOnly, Category = "Interverse|Telemetry")
+    int32 PendingWorkerTasks = 0;
+};
@@ -0,0 +1,58 @@
+// platforms/unreal/InterverseWorkPipeline.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "InterverseTelemetry.h"
+
+/**
+ * Moves the CPU-heavy part of SDK requests off the game thread: Work runs on a background task thread
+ * and its result is handed to OnGameThread, which only applies it to the caches and broadcasts.
+ * Work must not touch UObjects, the caches or the telemetry. Disabled pipelines run both inline.
+ * Run and GetPendingCount are game thread only.
+ */
+class INTERVERSESDK_API FInterverseWorkPipeline : public TSharedFromThis<FInterverseWorkPipeline, ESPMode::ThreadSafe>
+{
+public:
+    void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+
+    template <typename WorkType, typename ContinuationType>
+    void Run(WorkType&& Work, ContinuationType&& OnGameThread)
+    {
+        using ResultType = typename TDecay<decltype(Work())>::Type;
+
+        if (!bEnabled)
+        {
+            OnGameThread(Work());
+            return;
+        }
+
+        ++PendingCount;
+        INC_DWORD_STAT(STAT_InterverseWorkerTasksPending);
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+            [Pipeline = AsShared(), Work = Forward<WorkType>(Work), OnGameThread = Forward<ContinuationType>(OnGameThread)]() mutable
+            {
+                ResultType Result;
+                {
+                    TRACE_CPUPROFILER_EVENT_SCOPE(InterverseWork);
+                    Result = Work();
+                }
+
+                AsyncTask(ENamedThreads::GameThread,
+                    [Pipeline = MoveTemp(Pipeline), Result = MoveTemp(Result), OnGameThread = MoveTemp(OnGameThread)]() mutable
+                    {
+                        --Pipeline->PendingCount;
+                        DEC_DWORD_STAT(STAT_InterverseWorkerTasksPending);
+                        OnGameThread(MoveTemp(Result));
+                    });
+            });
+    }
+
+    // Work started but not yet handed back to the game thread
+    int32 GetPendingCount() const { return PendingCount; }
+
+private:
+    bool bEnabled = true;
+    int32 PendingCount = 0;
+};
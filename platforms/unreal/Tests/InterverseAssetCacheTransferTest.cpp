@@ -0,0 +1,89 @@
+// platforms/unreal/Tests/InterverseAssetCacheTransferTest.cpp
+#include "Misc/AutomationTest.h"
+#include "InterverseAssetCache.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Cache holding complete lists for wallets a, b and c, with one asset owned by a
+    void MakeTransferCache(FInterverseAssetCache& Cache, const FString& AssetId)
+    {
+        FInterverseAsset Asset;
+        Asset.AssetId = AssetId;
+        Asset.Owner = TEXT("wallet-a");
+        Asset.Metadata.Add(TEXT("damage"), TEXT("42"));
+
+        const FDateTime SyncTime(2026, 1, 1);
+        TArray<FInterverseAsset> Owned = { Asset };
+        Cache.ReplaceAll(TEXT("wallet-a"), MoveTemp(Owned), SyncTime);
+        Cache.ReplaceAll(TEXT("wallet-b"), TArray<FInterverseAsset>(), SyncTime);
+        Cache.ReplaceAll(TEXT("wallet-c"), TArray<FInterverseAsset>(), SyncTime);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterverseChainedTransferConfirmRejectTest, "Interverse.AssetCache.ChainedTransferConfirmThenReject",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInterverseChainedTransferConfirmRejectTest::RunTest(const FString& Parameters)
+{
+    const FString AssetId = TEXT("asset-1");
+    FInterverseAssetCache Cache;
+    MakeTransferCache(Cache, AssetId);
+
+    Cache.BeginPendingTransfer(AssetId, TEXT("wallet-a"), TEXT("wallet-b"));
+    Cache.BeginPendingTransfer(AssetId, TEXT("wallet-b"), TEXT("wallet-c"));
+
+    FInterverseAsset Cached;
+    TestTrue(TEXT("Shown under the last hop"), Cache.FindAsset(AssetId, Cached) && Cached.Owner == TEXT("wallet-c"));
+
+    // The HTTP response and the transfer_complete event both confirm the first hop
+    TestTrue(TEXT("First hop confirmed"), Cache.ConfirmTransfer(AssetId, TEXT("wallet-a"), TEXT("wallet-b")));
+    Cache.ConfirmTransfer(AssetId, TEXT("wallet-a"), TEXT("wallet-b"));
+    TestTrue(TEXT("Second hop still pending"), Cache.IsTransferPending(AssetId));
+
+    FString PendingOwner;
+    TestTrue(TEXT("Second hop rolled back"), Cache.RollbackTransfer(AssetId, TEXT("wallet-b"), TEXT("wallet-c"), PendingOwner));
+    TestEqual(TEXT("Rolled back from"), PendingOwner, FString(TEXT("wallet-c")));
+    TestFalse(TEXT("Nothing pending"), Cache.IsTransferPending(AssetId));
+
+    // The confirmed hop is kept: the asset is back under b, not a
+    TestTrue(TEXT("Asset found"), Cache.FindAsset(AssetId, Cached));
+    TestEqual(TEXT("Owner"), Cached.Owner, FString(TEXT("wallet-b")));
+    TestFalse(TEXT("Tag cleared"), Cached.bPendingTransfer);
+    TestEqual(TEXT("Metadata kept"), Cached.Metadata.FindRef(TEXT("damage")), FString(TEXT("42")));
+    TestEqual(TEXT("Nothing under c"), Cache.Find(TEXT("wallet-c"))->Assets.Num(), 0);
+
+    // A late rejection of the settled hop changes nothing
+    TestFalse(TEXT("Settled hop not rolled back"), Cache.RollbackTransfer(AssetId, TEXT("wallet-a"), TEXT("wallet-b"), PendingOwner));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterverseChainedTransferRejectFirstTest, "Interverse.AssetCache.ChainedTransferRejectFirstHop",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInterverseChainedTransferRejectFirstTest::RunTest(const FString& Parameters)
+{
+    const FString AssetId = TEXT("asset-1");
+    FInterverseAssetCache Cache;
+    MakeTransferCache(Cache, AssetId);
+
+    Cache.BeginPendingTransfer(AssetId, TEXT("wallet-a"), TEXT("wallet-b"));
+    Cache.BeginPendingTransfer(AssetId, TEXT("wallet-b"), TEXT("wallet-c"));
+
+    // Confirming the second hop does not settle the first one
+    TestTrue(TEXT("Second hop confirmed"), Cache.ConfirmTransfer(AssetId, TEXT("wallet-b"), TEXT("wallet-c")));
+    TestTrue(TEXT("First hop still pending"), Cache.IsTransferPending(AssetId));
+
+    FString PendingOwner;
+    TestTrue(TEXT("First hop rolled back"), Cache.RollbackTransfer(AssetId, TEXT("wallet-a"), TEXT("wallet-b"), PendingOwner));
+    TestFalse(TEXT("Chained hop dropped"), Cache.IsTransferPending(AssetId));
+
+    FInterverseAsset Cached;
+    TestTrue(TEXT("Asset found"), Cache.FindAsset(AssetId, Cached));
+    TestEqual(TEXT("Owner"), Cached.Owner, FString(TEXT("wallet-a")));
+    TestFalse(TEXT("Tag cleared"), Cached.bPendingTransfer);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,83 @@
+// platforms/unreal/Tests/InterverseCancellationTest.cpp
+#include "Misc/AutomationTest.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "InterverseRequestScheduler.h"
+#include "InterverseSDKComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Nothing listens on the discard port, so requests that do go out fail without reaching a node
+    const TCHAR* UnreachableNodeUrl = TEXT("http://127.0.0.1:9");
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterverseSchedulerCancelAllTest, "Interverse.RequestScheduler.CancelAllCompletesQueuedRequests",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInterverseSchedulerCancelAllTest::RunTest(const FString& Parameters)
+{
+    TSharedRef<FInterverseRequestScheduler> Scheduler = MakeShared<FInterverseRequestScheduler>(1);
+
+    // Shared with the completions, the in-flight one may only finish after the test returned
+    TSharedRef<TArray<int32>> Completions = MakeShared<TArray<int32>>();
+    TSharedRef<TArray<bool>> Succeeded = MakeShared<TArray<bool>>();
+    Completions->Init(0, 3);
+    Succeeded->Init(false, 3);
+
+    for (int32 Index = 0; Index < 3; ++Index)
+    {
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+        Request->SetURL(FString::Printf(TEXT("%s/verse/games/verify"), UnreachableNodeUrl));
+        Request->SetVerb(TEXT("GET"));
+        Request->OnProcessRequestComplete().BindLambda(
+            [Completions, Succeeded, Index](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+            {
+                ++(*Completions)[Index];
+                (*Succeeded)[Index] = bSuccess;
+            });
+        Scheduler->Submit(Request, EInterverseRequestPriority::Normal);
+    }
+    TestEqual(TEXT("Requests queued behind the in-flight cap"), Scheduler->GetStats().QueuedNormal, 2);
+
+    Scheduler->CancelAll();
+
+    for (int32 Index = 1; Index < 3; ++Index)
+    {
+        TestEqual(FString::Printf(TEXT("Completions of queued request %d"), Index), (*Completions)[Index], 1);
+        TestFalse(FString::Printf(TEXT("Queued request %d succeeded"), Index), (*Succeeded)[Index]);
+    }
+    TestEqual(TEXT("Requests still queued"), Scheduler->GetStats().QueuedNormal, 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterverseComponentDestroyTest, "Interverse.Component.DestroyResolvesPendingFutures",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInterverseComponentDestroyTest::RunTest(const FString& Parameters)
+{
+    // Never registered, so the component is collected without EndPlay
+    UInterverseSDKComponent* Component = NewObject<UInterverseSDKComponent>();
+    Component->NodeUrl = UnreachableNodeUrl;
+    Component->GameId = TEXT("test");
+    Component->ApiKey = TEXT("test");
+    Component->MaxRequestsInFlightPerHost = 1;
+
+    TFuture<FInterverseBalanceResult> InFlight = Component->GetBalanceAsync(TEXT("wallet-a"));
+    TFuture<FInterverseBalanceResult> Queued = Component->GetBalanceAsync(TEXT("wallet-b"));
+    TFuture<FInterverseBalanceResult> Joined = Component->GetBalanceAsync(TEXT("wallet-b"));
+    TFuture<FInterverseWalletResult> Wallet = Component->CreateWalletAsync();
+    TestEqual(TEXT("Requests queued behind the in-flight cap"), Component->GetRequestQueueStats().QueuedInteractive, 2);
+
+    Component->ConditionalBeginDestroy();
+
+    TestTrue(TEXT("In-flight read resolved"), InFlight.IsReady() && !InFlight.Get().bSuccess);
+    TestTrue(TEXT("Queued read resolved"), Queued.IsReady() && !Queued.Get().bSuccess);
+    TestTrue(TEXT("Joined read resolved"), Joined.IsReady() && !Joined.Get().bSuccess);
+    TestTrue(TEXT("Queued wallet creation resolved"), Wallet.IsReady() && !Wallet.Get().bSuccess);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
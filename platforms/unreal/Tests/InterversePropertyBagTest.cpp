@@ -0,0 +1,78 @@
+// platforms/unreal/Tests/InterversePropertyBagTest.cpp
+#include "Misc/AutomationTest.h"
+#include "InterverseAssetCache.h"
+#include "InterversePropertyBag.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterversePropertyBagRoundTripTest, "Interverse.PropertyBag.MapRoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInterversePropertyBagRoundTripTest::RunTest(const FString& Parameters)
+{
+    TMap<FString, float> Numeric;
+    Numeric.Add(TEXT("Damage"), 42.0f);
+    Numeric.Add(TEXT("Durability"), 0.5f);
+    Numeric.Add(TEXT("Weight"), 3.25f);
+
+    FInterverseNumericPropertyBag Bag;
+    Bag.FromMap(Numeric);
+    TestEqual(TEXT("Entries"), Bag.Num(), 3);
+    TestTrue(TEXT("Damage found"), Bag.Find(TEXT("Damage")) && *Bag.Find(TEXT("Damage")) == 42.0f);
+    TestNull(TEXT("Unknown key"), Bag.Find(TEXT("NeverRegisteredKey")));
+
+    TMap<FString, float> RoundTrip;
+    Bag.ToMap(RoundTrip);
+    TestEqual(TEXT("Round-trip entries"), RoundTrip.Num(), Numeric.Num());
+    for (const TPair<FString, float>& Pair : Numeric)
+    {
+        const float* Value = RoundTrip.Find(Pair.Key);
+        TestTrue(FString::Printf(TEXT("Round-trip %s"), *Pair.Key), Value && *Value == Pair.Value);
+    }
+
+    // Registry keys are case-sensitive, unlike FName
+    FInterverseStringPropertyBag Strings;
+    Strings.Set(TEXT("Element"), TEXT("Fire"));
+    Strings.Set(TEXT("element"), TEXT("Ice"));
+    TestEqual(TEXT("Keys differing in case"), Strings.Num(), 2);
+    TestEqual(TEXT("Exact key"), *Strings.Find(TEXT("element")), FString(TEXT("Ice")));
+    TestTrue(TEXT("Remove"), Strings.Remove(TEXT("Element")));
+    TestEqual(TEXT("Key after remove"), *Strings.Find(TEXT("element")), FString(TEXT("Ice")));
+    TestEqual(TEXT("Interned once"), FInterversePropertyKeys::Intern(TEXT("Damage")), FInterversePropertyKeys::Find(TEXT("Damage")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterverseCompactAssetCacheTest, "Interverse.PropertyBag.CacheKeepsMetadata",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInterverseCompactAssetCacheTest::RunTest(const FString& Parameters)
+{
+    FInterverseAsset Asset;
+    Asset.AssetId = TEXT("asset-1");
+    Asset.Owner = TEXT("wallet-a");
+    Asset.Category = EInterverseItemCategory::Weapon;
+    Asset.Rarity = EInterverseRarity::Epic;
+    Asset.Metadata.Add(TEXT("damage"), TEXT("42"));
+    Asset.Metadata.Add(TEXT("tags"), TEXT("sword,fire"));
+    Asset.GameId = TEXT("test");
+
+    FInterverseAssetCache Cache;
+    TArray<FInterverseAsset> Assets = { Asset };
+    Cache.ReplaceAll(Asset.Owner, MoveTemp(Assets), FDateTime(2026, 1, 1));
+
+    FInterverseAsset Cached;
+    TestTrue(TEXT("Asset found"), Cache.FindAsset(Asset.AssetId, Cached));
+    TestTrue(TEXT("Category"), Cached.Category == Asset.Category);
+    TestEqual(TEXT("Metadata entries"), Cached.Metadata.Num(), Asset.Metadata.Num());
+    TestEqual(TEXT("Metadata value"), Cached.Metadata.FindRef(TEXT("damage")), FString(TEXT("42")));
+
+    // The index reads the tags of the compact record
+    FInterverseAssetQuery Query;
+    Query.Tags.Add(TEXT("fire"));
+    TArray<FInterverseAsset> Matches;
+    TestTrue(TEXT("Query"), Cache.QueryAssets(Asset.Owner, Query, Matches));
+    TestEqual(TEXT("Tag matches"), Matches.Num(), 1);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS